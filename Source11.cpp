@@ -6,6 +6,35 @@
 #include <map>
 #include <stack>
 #include <queue>
+#include <random>
+#include <string>
+#include <functional>
+
+#include "Source13.cpp"
+#include "Source14.cpp"
+#include "Source15.cpp"
+#include "Source16.cpp"
+#include "Source17.cpp"
+#include "Source18.cpp"
+#include "Source19.cpp"
+#include "Source20.cpp"
+#include "Source21.cpp"
+#include "Source22.cpp"
+#include "Source23.cpp"
+#include "Source24.cpp"
+#include "Source25.cpp"
+#include "Source26.cpp"
+#include "Source27.cpp"
+#include "Source28.cpp"
+#include "Source29.cpp"
+#include "Source30.cpp"
+#include "Source31.cpp"
+#include "Source32.cpp"
+#include "Source33.cpp"
+#include "Source34.cpp"
+#include "Source35.cpp"
+#include "Source36.cpp"
+#include "Source37.cpp"
 
 using namespace std;
 using namespace chrono;
@@ -81,6 +110,8 @@ void measureTime(const string& name, Func func, int n) {
     auto end = high_resolution_clock::now();
     auto duration = duration_cast<microseconds>(end - start);
 
+    BenchmarkSink::report("demonstrateComplexity", name, "n=" + to_string(n),
+        (double)duration.count());
     cout << name << " (n=" << n << "): "
         << duration.count() << " " << endl;
 }
@@ -119,6 +150,8 @@ void demonstrateComplexity() {
             ComplexityExamples::linearithmicTime(arr);
             auto end = high_resolution_clock::now();
             auto duration = duration_cast<microseconds>(end - start);
+            BenchmarkSink::report("demonstrateComplexity", "O(n log n) - ",
+                "n=" + to_string(n), (double)duration.count());
             cout << "O(n log n) - : " << duration.count() << " " << endl;
         }
 
@@ -172,6 +205,7 @@ public:
     }
 
     //   - O(n log n)  
+    //   ;   - quickSortParallel
     static void quickSort(vector<int>& arr, int low, int high) {
         if (low < high) {
             int pi = partition(arr, low, high);
@@ -194,30 +228,23 @@ public:
         return i + 1;
     }
 
+    //     fork-join    (Source37.cpp),
+    //     
+    static void quickSortParallel(vector<int>& arr) {
+        ParallelDivideAndConquer::quickSort(arr, ForkJoinPool::shared());
+    }
+
     //     (NP-)
-    // ,      target
+    // ,      target.
+    // : O(n * target / 64)     (Source28.cpp)
     static bool subsetSum(const vector<int>& nums, int target) {
-        int n = nums.size();
-        vector<vector<bool>> dp(n + 1, vector<bool>(target + 1, false));
-
-        //  :  0  
-        for (int i = 0; i <= n; i++) {
-            dp[i][0] = true;
-        }
-
-        //    
-        for (int i = 1; i <= n; i++) {
-            for (int j = 1; j <= target; j++) {
-                if (j < nums[i - 1]) {
-                    dp[i][j] = dp[i - 1][j];
-                }
-                else {
-                    dp[i][j] = dp[i - 1][j] || dp[i - 1][j - nums[i - 1]];
-                }
-            }
-        }
+        return BitsetSubsetSum::exists(nums, target);
+    }
 
-        return dp[n][target];
+    //       10^15,     :
+    //  , O(2^(n/2))  n <= 60 (Source29.cpp)
+    static bool subsetSumLarge(const vector<long long>& nums, long long target) {
+        return MeetInTheMiddle::subsetSum(nums, target).found;
     }
 
     //   (TSP) - NP-
@@ -247,14 +274,34 @@ public:
 
         return minPath;
     }
+
+    //   TSP  -, O(2^n * n^2)  n! (Source30.cpp).
+    //        
+    static int travelingSalesmanHeldKarp(const vector<vector<int>>& graph, int n) {
+        if ((int)graph.size() != n) {
+            throw invalid_argument("      ");
+        }
+        HeldKarpSolver<>::Options options;
+        options.threads = max(1u, thread::hardware_concurrency());
+        options.branchAndBound = true;
+        return HeldKarpSolver<>::solve(graph, options).length;
+    }
+
+    //      :   
+    //  2-opt + Or-opt     (Source31.cpp)
+    static double travelingSalesmanLocalSearch(const vector<LocalSearchTsp::Point>& cities, long long budgetMs) {
+        LocalSearchTsp::Options options;
+        options.threads = max(1u, thread::hardware_concurrency());
+        options.starts = (int)options.threads;
+        options.timeBudgetMs = budgetMs;
+        return LocalSearchTsp::solve(cities, options).length;
+    }
 };
 
 // ====================   ====================
 
 class RecursiveAlgorithms {
 private:
-    static map<int, long long> fibCache;  //    
-
 public:
     // 1.  - O(n)
     static long long factorial(int n) {
@@ -272,23 +319,27 @@ public:
         return fibonacciNaive(n - 1) + fibonacciNaive(n - 2);
     }
 
-    //   () - O(n)
-    static long long fibonacciMemoization(int n) {
-        if (n <= 1) return n;
-
-        // ,     
-        if (fibCache.find(n) != fibCache.end()) {
-            return fibCache[n];
-        }
+    //   ,  n - 1  n - 2  (Source37.cpp)
+    static long long fibonacciParallel(int n) {
+        return ParallelDivideAndConquer::fibonacci(n, ForkJoinPool::shared());
+    }
 
-        //     
-        long long result = fibonacciMemoization(n - 1) + fibonacciMemoization(n - 2);
-        fibCache[n] = result;
+    //    :    ,    
+    static auto& fibonacciCache() {
+        static auto cache = memoize<int, long long>([](auto& self, int n) -> long long {
+            if (n <= 1) return n;
+            return self(n - 1) + self(n - 2);
+            });
+        return cache;
+    }
 
-        return result;
+    //   () - O(n)
+    static long long fibonacciMemoization(int n) {
+        return fibonacciCache()(n);
     }
 
     //   - O(n)
+    // long long   fib(92):   n - FastFibonacci (Source27.cpp)
     static long long fibonacciIterative(int n) {
         if (n <= 1) return n;
 
@@ -358,6 +409,8 @@ public:
     }
 
     // 7.    - O(n!)
+    //  n!    ;      -
+    // Permutations / HeapPermutations   LazyEnumerations::permutations (Source34.cpp)
     static void generatePermutations(vector<int>& arr, int start, vector<vector<int>>& result) {
         if (start == arr.size() - 1) {
             result.push_back(arr);
@@ -372,6 +425,8 @@ public:
     }
 
     // 8.     (DFS)
+    //          ;  
+    //  - ArenaTree (Source36.cpp), . dfsIterative  bfsByLevels
     struct TreeNode {
         int value;
         TreeNode* left;
@@ -407,6 +462,18 @@ public:
         }
     }
 
+    //        :     
+    //     
+    static void dfsIterative(const TreeNode* root) {
+        ArenaTree<int> tree = ArenaTree<int>::fromPointers(root);
+        tree.preorder([&](uint32_t node) { cout << tree.value(node) << " "; });
+    }
+
+    static void bfsByLevels(const TreeNode* root) {
+        ArenaTree<int> tree = ArenaTree<int>::fromPointers(root);
+        tree.levelOrder([&](uint32_t node) { cout << tree.value(node) << " "; });
+    }
+
     // 10.   - O(n log n)
     static void mergeSort(vector<int>& arr, int left, int right) {
         if (left < right) {
@@ -419,6 +486,12 @@ public:
         }
     }
 
+    //        (Source37.cpp):   
+    // O(n log n),   O(log^3 n)
+    static void mergeSortParallel(vector<int>& arr) {
+        ParallelDivideAndConquer::mergeSort(arr, ForkJoinPool::shared());
+    }
+
     static void merge(vector<int>& arr, int left, int mid, int right) {
         int n1 = mid - left + 1;
         int n2 = right - mid;
@@ -458,9 +531,6 @@ public:
     }
 };
 
-//   
-map<int, long long> RecursiveAlgorithms::fibCache;
-
 // ====================    ====================
 
 class RecursionAnalysis {
@@ -520,6 +590,7 @@ public:
 
     //  4: T(n) = 2T(n-1) + O(1) ? O(2^n)
     //  
+    //    2^n  (    - printSubsetsGray)
     static void exponentialRecurrence(vector<int>& nums, int index, vector<int>& current) {
         if (index == nums.size()) {
             cout << "{ ";
@@ -537,6 +608,24 @@ public:
         current.pop_back();
     }
 
+    //     :    ,
+    //      O(1)
+    static void printSubsetsGray(const vector<int>& nums) {
+        GraySubsets subsets((int)nums.size());
+        long long sum = 0;
+        do {
+            if (subsets.rank() > 0) {
+                int changed = subsets.changedElement();
+                sum += subsets.added() ? nums[changed] : -nums[changed];
+            }
+            cout << "{ ";
+            for (size_t i = 0; i < nums.size(); i++) {
+                if ((subsets.current() >> i) & 1) cout << nums[i] << " ";
+            }
+            cout << "}  " << sum << endl;
+        } while (subsets.next());
+    }
+
     //     
     static void analyzeRecurrence() {
         cout << "\n===    ===" << endl;
@@ -563,6 +652,8 @@ public:
 class PracticalExamples {
 public:
     // 1.     (DFS)
+    //   ,  ,    rows * cols -
+    //    . shortestPathInMaze
     static bool mazeSolver(vector<vector<int>>& maze, int x, int y, int targetX, int targetY) {
         int rows = maze.size();
         int cols = maze[0].size();
@@ -587,7 +678,17 @@ public:
         return false;
     }
 
+    //    (-1,   )     
+    //   (Source35.cpp).   ,   
+    static int shortestPathInMaze(const vector<vector<int>>& maze, int x, int y, int targetX, int targetY) {
+        BitGrid grid = BitGrid::fromMaze(maze);
+        GridPathfinder finder(grid);
+        return finder.findPath({ x, y }, { targetX, targetY }, GridPathfinder::Algorithm::JumpPointSearch).length;
+    }
+
     // 2.    (0/1 Knapsack)
+    //     ;    -
+    // knapsackBottomUp 
     static int knapsack(const vector<int>& weights, const vector<int>& values, int capacity, int n) {
         //  
         if (n == 0 || capacity == 0) return 0;
@@ -607,6 +708,8 @@ public:
     }
 
     // 3.   (Coin Change)
+    //        ; 
+    //     - coinChangeBottomUp 
     static int coinChange(const vector<int>& coins, int amount) {
         if (amount == 0) return 0;
         if (amount < 0) return -1;
@@ -634,7 +737,82 @@ public:
         return result;
     }
 
+    //    : O(n * capacity),   dp  
+    // max (Source32.cpp).       
+    static long long knapsackBottomUp(const vector<int>& weights, const vector<int>& values, int capacity) {
+        vector<KnapsackEngine::Item> items(weights.size());
+        for (size_t i = 0; i < weights.size(); i++) items[i] = { weights[i], values[i], 1 };
+        KnapsackEngine::Options options;
+        options.threads = max(1u, thread::hardware_concurrency());
+        return KnapsackEngine::maxValue(items, capacity, options);
+    }
+
+    //         amount, O(amount * coins)
+    // (Source33.cpp).        
+    static int coinChangeBottomUp(const vector<int>& coins, int amount) {
+        if (amount < 0) return -1;
+        return CoinChangeTable(coins, amount).minCoins(amount);
+    }
+
+    //       ,   10^9 + 7
+    static uint32_t coinChangeWays(const vector<int>& coins, int amount) {
+        CoinChangeTable::Options options;
+        options.countWays = true;
+        return CoinChangeTable(coins, amount, options).ways(amount);
+    }
+
+    //       10^15:    2^n 
+    static long long knapsackLarge(const vector<long long>& weights, const vector<long long>& values,
+        long long capacity) {
+        return MeetInTheMiddle::knapsack(weights, values, capacity).value;
+    }
+
+    //      (. Source26.cpp)
+
+    //  - O(n * capacity)   (capacity, n)
+    static int knapsackMemoized(const vector<int>& weights, const vector<int>& values, int capacity, int n) {
+        auto solve = memoize<pair<int, int>, int>([&](auto& self, pair<int, int> state) -> int {
+            auto [cap, count] = state;
+            if (count == 0 || cap == 0) return 0;
+            int withoutItem = self({ cap, count - 1 });
+            if (weights[count - 1] > cap) return withoutItem;
+            return max(withoutItem, values[count - 1] + self({ cap - weights[count - 1], count - 1 }));
+            });
+        return solve({ capacity, n });
+    }
+
+    //   - O(amount * coins)
+    static int coinChangeMemoized(const vector<int>& coins, int amount) {
+        auto solve = memoize<int, int>([&](auto& self, int rest) -> int {
+            if (rest == 0) return 0;
+            int minCoins = INT_MAX;
+            for (int coin : coins) {
+                if (coin > rest) continue;
+                int subProblem = self(rest - coin);
+                if (subProblem != -1) {
+                    minCoins = min(minCoins, subProblem + 1);
+                }
+            }
+            return minCoins == INT_MAX ? -1 : minCoins;
+            });
+        return amount < 0 ? -1 : solve(amount);
+    }
+
+    //   - O(n^2);    
+    static long long catalanNumberMemoized(int n) {
+        static auto catalan = memoize<int, long long>([](auto& self, int k) -> long long {
+            if (k <= 1) return 1;
+            long long result = 0;
+            for (int i = 0; i < k; i++) {
+                result += self(i) * self(k - i - 1);
+            }
+            return result;
+            });
+        return catalan(n);
+    }
+
     // 5.    
+    //     current;   - generateParenthesesLazy
     static void generateParentheses(int n, int open, int close, string current) {
         if (current.length() == n * 2) {
             cout << current << endl;
@@ -649,11 +827,208 @@ public:
             generateParentheses(n, open, close + 1, current + ")");
         }
     }
+
+    //          :
+    //      (Source34.cpp)
+    static void generateParenthesesLazy(int n) {
+        BalancedParentheses sequences(n);
+        do {
+            cout << sequences.current() << endl;
+        } while (sequences.next());
+    }
 };
 
+// ====================    ====================
+
+//           .
+//   ,    
+int fitComplexity() {
+    cout << "===    ===" << endl;
+
+    ComplexityFitter::Options options;
+    ComplexityFitter::Options exponential = options;
+    exponential.minN = 1;
+
+    auto randomArray = [](long long n) {
+        vector<int> arr((size_t)n);
+        mt19937 gen((unsigned)n);
+        for (int& x : arr) x = (int)(gen() % 1000000);
+        return arr;
+    };
+    struct SearchInput {
+        vector<int> arr;
+        int target;
+    };
+
+    int suspects = 0;
+    auto check = [&](const string& name, const ComplexityFit& fit, GrowthOrder expected,
+        const ComplexityFitter::Options& used) {
+            if (!ComplexityFitter::report(name, fit, expected, used)) suspects++;
+        };
+
+    cout << "\nComplexityExamples:" << endl;
+    check("constantTime", ComplexityFitter::measure([](long long n) {
+        return ComplexityExamples::constantTime((int)n);
+        }, options), GrowthOrder::Constant, options);
+    check("logarithmicTime", ComplexityFitter::measure([](long long n) {
+        return ComplexityExamples::logarithmicTime((int)n);
+        }, options), GrowthOrder::Logarithmic, options);
+    check("linearTime", ComplexityFitter::measure([](long long n) {
+        return ComplexityExamples::linearTime((int)n);
+        }, options), GrowthOrder::Linear, options);
+    check("linearithmicTime", ComplexityFitter::measure(randomArray, [](vector<int>& arr) {
+        ComplexityExamples::linearithmicTime(arr);
+        }, options), GrowthOrder::Linearithmic, options);
+    check("quadraticTime", ComplexityFitter::measure([](long long n) {
+        return ComplexityExamples::quadraticTime((int)n);
+        }, options), GrowthOrder::Quadratic, options);
+    check("exponentialTime", ComplexityFitter::measure([](long long n) {
+        return ComplexityExamples::exponentialTime((int)n);
+        }, exponential), GrowthOrder::Exponential, exponential);
+
+    cout << "\nRecursiveAlgorithms:" << endl;
+    check("fibonacciNaive", ComplexityFitter::measure([](long long n) {
+        return RecursiveAlgorithms::fibonacciNaive((int)n);
+        }, exponential), GrowthOrder::Exponential, exponential);
+    check("fibonacciIterative", ComplexityFitter::measure([](long long n) {
+        return RecursiveAlgorithms::fibonacciIterative((int)n);
+        }, options), GrowthOrder::Linear, options);
+    check("binarySearch", ComplexityFitter::measureShared([](long long n) {
+        SearchInput input{ vector<int>((size_t)n), -1 };  // -1   :  
+        for (long long i = 0; i < n; i++) input.arr[(size_t)i] = (int)(2 * i);
+        return input;
+        }, [](const SearchInput& input) {
+            return RecursiveAlgorithms::binarySearch(input.arr, input.target, 0, (int)input.arr.size() - 1);
+        }, options), GrowthOrder::Logarithmic, options);
+    check("power", ComplexityFitter::measure([](long long n) {
+        return RecursiveAlgorithms::power(1.0000001, (int)n);
+        }, options), GrowthOrder::Logarithmic, options);
+    check("mergeSort", ComplexityFitter::measure(randomArray, [](vector<int>& arr) {
+        RecursiveAlgorithms::mergeSort(arr, 0, (int)arr.size() - 1);
+        }, options), GrowthOrder::Linearithmic, options);
+
+    cout << "\n    : " << suspects << endl;
+    return suspects;
+}
+
+// ====================     ====================
+
+//    .   
+int selfTest() {
+    const vector<pair<string, function<bool()>>> checks = {
+        { "SuffixArrayBenchmark", SuffixArrayBenchmark::verify },
+        { "MultiPatternBenchmark", MathLib::MultiPatternBenchmark::verify },
+        { "OrderStatisticsBenchmark", OrderStatisticsBenchmark::verify },
+        { "SortServiceBenchmark", SortServiceBenchmark::verify },
+        { "BenchmarkStoreBenchmark", BenchmarkStoreBenchmark::verify },
+        { "ComplexityFitBenchmark", ComplexityFitBenchmark::verify },
+        { "MemoizeBenchmark", MemoizeBenchmark::verify },
+        { "FastFibonacciBenchmark", FastFibonacciBenchmark::verify },
+        { "BitsetSubsetSumBenchmark", BitsetSubsetSumBenchmark::verify },
+        { "MeetInTheMiddleBenchmark", MeetInTheMiddleBenchmark::verify },
+        { "HeldKarpBenchmark", HeldKarpBenchmark::verify },
+        { "LocalSearchTspBenchmark", LocalSearchTspBenchmark::verify },
+        { "KnapsackEngineBenchmark", KnapsackEngineBenchmark::verify },
+        { "CoinChangeBenchmark", CoinChangeBenchmark::verify },
+        { "LazyEnumerationBenchmark", LazyEnumerationBenchmark::verify },
+        { "GridPathfinderBenchmark", GridPathfinderBenchmark::verify },
+        { "ArenaTreeBenchmark", ArenaTreeBenchmark::verify },
+        { "ForkJoinBenchmark", ForkJoinBenchmark::verify },
+    };
+
+    vector<string> failed;
+    for (const auto& [name, check] : checks) {
+        bool ok = false;
+        try {
+            ok = check();
+        }
+        catch (const exception& e) {
+            cout << ": " << e.what() << endl;
+        }
+        if (!ok) failed.push_back(name);
+    }
+
+    cout << "\n: " << checks.size() << ", : " << failed.size() << endl;
+    for (const string& name : failed) cout << "  " << name << endl;
+    return (int)failed.size();
+}
+
+//   :  , all - ,   - 
+int benchReport(const vector<string>& names) {
+    const vector<BenchmarkTool::Suite> reports = {
+        { "compressedArray", [] { CompressedArrayBenchmark::compareWithUncompressed(); } },
+        { "setIntersection", [] { SetOperationsBenchmark::compareIntersection(); } },
+        { "mappedStartup", [] { MappedArrayBenchmark::compareStartup(); } },
+        { "filters", [] { FilterBenchmark::compareFilters(); } },
+        { "hashIndex", [] { HashIndexBenchmark::compareWithSearch(); } },
+        { "adaptiveSearch", [] { AdaptiveSearchBenchmark::compareStrategies(); } },
+        { "stringSorts", [] { StringSortBenchmark::compareStringSorts(); } },
+        { "suffixArray", [] { SuffixArrayBenchmark::compareWithScan(); } },
+        { "multiPattern", [] { MathLib::MultiPatternBenchmark::compareThroughput(); } },
+        { "orderStatistics", [] { OrderStatisticsBenchmark::compareStreaming(); } },
+        { "memoize", [] { MemoizeBenchmark::compareLookups(); } },
+        { "fastFibonacci", [] { FastFibonacciBenchmark::compareWithIterative(); } },
+        { "bitsetSubsetSum", [] { BitsetSubsetSumBenchmark::compareWithTable(); } },
+        { "meetInTheMiddle", [] { MeetInTheMiddleBenchmark::compareWithSorting(); } },
+        { "heldKarp", [] { HeldKarpBenchmark::compareWithBruteForce(); } },
+        { "localSearchTsp", [] { LocalSearchTspBenchmark::compareInstanceSizes(); } },
+        { "knapsack", [] { KnapsackEngineBenchmark::compareWithTable(); } },
+        { "coinChange", [] { CoinChangeBenchmark::compareMethods(); } },
+        { "lazyEnumeration", [] { LazyEnumerationBenchmark::compareWithMaterialized(); } },
+        { "gridPathfinder", [] { GridPathfinderBenchmark::compareAlgorithms(); } },
+        { "distanceFields", [] { GridPathfinderBenchmark::compareDistanceFields(); } },
+        { "arenaTree", [] { ArenaTreeBenchmark::compareTraversals(); } },
+        { "forkJoin", [] { ForkJoinBenchmark::compareSpeedup(); } },
+    };
+
+    if (names.empty()) {
+        cout << " (--bench-report <>... | all):" << endl;
+        for (const BenchmarkTool::Suite& report : reports) cout << "  " << report.first << endl;
+        return BenchmarkTool::EXIT_OK;
+    }
+    for (const string& name : names) {
+        if (name != "all" && none_of(reports.begin(), reports.end(),
+            [&](const BenchmarkTool::Suite& report) { return report.first == name; })) {
+            cerr << " : " << name << endl;
+            return BenchmarkTool::EXIT_ERROR;
+        }
+    }
+    for (const BenchmarkTool::Suite& report : reports) {
+        if (find(names.begin(), names.end(), "all") != names.end() ||
+            find(names.begin(), names.end(), report.first) != names.end()) {
+            report.second();
+        }
+    }
+    return BenchmarkTool::EXIT_OK;
+}
+
 // ====================   ====================
 
-int main() {
+int main(int argc, char* argv[]) {
+    //      (. BenchmarkTool)
+    if (BenchmarkTool::handles(argc, argv)) {
+        return BenchmarkTool::run(argc, argv, {
+            { "demonstrateComplexity", demonstrateComplexity },
+            { "compareSortingAlgorithms", AlgorithmComparator::compareSortingAlgorithms },
+            { "compareSearchAlgorithms", AlgorithmComparator::compareSearchAlgorithms },
+        });
+    }
+
+    //     :   1  
+    if (argc > 1 && string(argv[1]) == "--fit-complexity") {
+        return fitComplexity() > 0 ? 1 : 0;
+    }
+
+    //   :   1,    
+    if (argc > 1 && string(argv[1]) == "--self-test") {
+        return selfTest() > 0 ? 1 : 0;
+    }
+
+    //    (compare*)
+    if (argc > 1 && string(argv[1]) == "--bench-report") {
+        return benchReport(vector<string>(argv + 2, argv + argc));
+    }
+
     cout << "    C++" << endl;
     cout << "==========================\n" << endl;
 
@@ -680,6 +1055,13 @@ int main() {
     for (int i = 0; i <= 20; i++) {
         cout << "fib(" << i << ") = " << RecursiveAlgorithms::fibonacciMemoization(i) << endl;
     }
+    MemoStats fibStats = RecursiveAlgorithms::fibonacciCache().getStats();
+    cout << ":  " << fibStats.hits << ",  " << fibStats.misses << endl;
+
+    cout << "\n  (O(log n)):" << endl;
+    cout << "fib(186) = " << FastFibonacci::toString(FastFibonacci::exact(186)) << endl;
+    cout << "fib(10^18) mod (10^9 + 7) = "
+        << FastFibonacci::modular(1000000000000000000ULL, 1000000007ULL) << endl;
 
     // 3.  
     cout << "\n3.   (O(log n)):" << endl;
@@ -708,11 +1090,73 @@ int main() {
     for (int num : arr) cout << num << " ";
     cout << endl;
 
+    //      
+    cout << "\nFORK-JOIN  " << ForkJoinPool::shared().getThreads() << " :" << endl;
+    mt19937 sortGen(7);
+    vector<int> bigArr(2000000);
+    for (int& x : bigArr) x = (int)sortGen();
+    vector<int> bigArrCopy = bigArr;
+    auto sortStart = high_resolution_clock::now();
+    RecursiveAlgorithms::mergeSort(bigArr, 0, (int)bigArr.size() - 1);
+    auto sortMiddle = high_resolution_clock::now();
+    RecursiveAlgorithms::mergeSortParallel(bigArrCopy);
+    auto sortEnd = high_resolution_clock::now();
+    cout << " 2*10^6 :  " << duration_cast<milliseconds>(sortMiddle - sortStart).count()
+        << " , fork-join " << duration_cast<milliseconds>(sortEnd - sortMiddle).count() << " "
+        << (bigArr == bigArrCopy ? "" : " ") << endl;
+    bigArr = bigArrCopy;
+    shuffle(bigArr.begin(), bigArr.end(), sortGen);
+    bigArrCopy = bigArr;
+    sortStart = high_resolution_clock::now();
+    ComplexityClasses::quickSort(bigArr, 0, (int)bigArr.size() - 1);
+    sortMiddle = high_resolution_clock::now();
+    ComplexityClasses::quickSortParallel(bigArrCopy);
+    sortEnd = high_resolution_clock::now();
+    cout << " 2*10^6 :  " << duration_cast<milliseconds>(sortMiddle - sortStart).count()
+        << " , fork-join " << duration_cast<milliseconds>(sortEnd - sortMiddle).count() << " "
+        << (bigArr == bigArrCopy ? "" : " ") << endl;
+    auto fibStart = high_resolution_clock::now();
+    long long fibSerial = RecursiveAlgorithms::fibonacciNaive(32);
+    auto fibMiddle = high_resolution_clock::now();
+    long long fibForked = RecursiveAlgorithms::fibonacciParallel(32);
+    auto fibEnd = high_resolution_clock::now();
+    cout << "fib(32) = " << fibForked << ":  " << duration_cast<milliseconds>(fibMiddle - fibStart).count()
+        << " , fork-join " << duration_cast<milliseconds>(fibEnd - fibMiddle).count() << " "
+        << (fibSerial == fibForked ? "" : " ") << endl;
+
     // 6. 
     cout << "\n6.    (O(log min(a,b))):" << endl;
     int a = 56, b = 98;
     cout << "(" << a << ", " << b << ") = " << RecursiveAlgorithms::gcd(a, b) << endl;
 
+    //  
+    cout << "\n :" << endl;
+    RecursiveAlgorithms::TreeNode treeNodes[] = { 1, 2, 3, 4, 5, 6 };
+    treeNodes[0].left = &treeNodes[1];
+    treeNodes[0].right = &treeNodes[2];
+    treeNodes[1].left = &treeNodes[3];
+    treeNodes[1].right = &treeNodes[4];
+    treeNodes[2].right = &treeNodes[5];
+    cout << "DFS: ";
+    RecursiveAlgorithms::dfs(&treeNodes[0]);
+    cout << "\nDFS  : ";
+    RecursiveAlgorithms::dfsIterative(&treeNodes[0]);
+    cout << "\nBFS: ";
+    RecursiveAlgorithms::bfs(&treeNodes[0]);
+    cout << "\nBFS  : ";
+    RecursiveAlgorithms::bfsByLevels(&treeNodes[0]);
+    cout << endl;
+    vector<int> treeKeys(10000000);
+    for (int i = 0; i < (int)treeKeys.size(); i++) treeKeys[i] = 2 * i;
+    auto treeStart = high_resolution_clock::now();
+    ArenaTree<int> bigTree = ArenaTree<int>::fromSorted(treeKeys);
+    long long treeSum = 0;
+    bigTree.preorder([&](uint32_t node) { treeSum += bigTree.value(node); });
+    auto treeEnd = high_resolution_clock::now();
+    cout << "10^7      :  " << bigTree.height() << ",  " << treeSum
+        << ",  777776 : " << (bigTree.find(777776) != ArenaTree<int>::NONE ? "" : "") << " ("
+        << duration_cast<milliseconds>(treeEnd - treeStart).count() << " )" << endl;
+
     // 7.  
     cout << "\n\n===   ===" << endl;
 
@@ -723,6 +1167,23 @@ int main() {
     int maxValue = PracticalExamples::knapsack(weights, values, capacity, weights.size());
     cout << "\n  :" << endl;
     cout << "    " << capacity << ": " << maxValue << endl;
+    cout << " : " << PracticalExamples::knapsackMemoized(weights, values, capacity, weights.size()) << endl;
+    cout << " : " << PracticalExamples::knapsackBottomUp(weights, values, capacity) << endl;
+    mt19937 itemGen(7);
+    vector<int> manyWeights(500), manyValues(500);
+    for (int i = 0; i < 500; i++) {
+        manyWeights[i] = 1 + (int)(itemGen() % 2000);
+        manyValues[i] = 1 + (int)(itemGen() % 1000);
+    }
+    auto knapsackStart = high_resolution_clock::now();
+    long long manyValue = PracticalExamples::knapsackBottomUp(manyWeights, manyValues, 100000);
+    auto knapsackEnd = high_resolution_clock::now();
+    cout << "500 ,  100000: " << manyValue << "  "
+        << duration_cast<milliseconds>(knapsackEnd - knapsackStart).count() << " " << endl;
+    vector<long long> heavyWeights = { 400000000000000, 300000000000000, 500000000000000, 200000000000000 };
+    vector<long long> heavyValues = { 7, 5, 9, 3 };
+    cout << "  10^15,  9 * 10^14: "
+        << PracticalExamples::knapsackLarge(heavyWeights, heavyValues, 900000000000000) << endl;
 
     //  
     vector<int> coins = { 1, 2, 5 };
@@ -730,16 +1191,71 @@ int main() {
     int minCoins = PracticalExamples::coinChange(coins, amount);
     cout << "\n :" << endl;
     cout << "     " << amount << ": " << minCoins << endl;
+    cout << "    1000: " << PracticalExamples::coinChangeMemoized(coins, 1000) << endl;
+    cout << "    1000000: " << PracticalExamples::coinChangeBottomUp(coins, 1000000)
+        << ",    100: " << PracticalExamples::coinChangeWays(coins, 100) << endl;
+
+    // 
+    vector<vector<int>> cityGraph = {
+        { 0, 29, 20, 21, 16, 31, 100, 12 },
+        { 29, 0, 15, 29, 28, 40, 72, 21 },
+        { 20, 15, 0, 15, 14, 25, 81, 9 },
+        { 21, 29, 15, 0, 4, 12, 92, 12 },
+        { 16, 28, 14, 4, 0, 16, 94, 9 },
+        { 31, 40, 25, 12, 16, 0, 95, 24 },
+        { 100, 72, 81, 92, 94, 95, 0, 90 },
+        { 12, 21, 9, 12, 9, 24, 90, 0 }
+    };
+    cout << "\n (8 ):" << endl;
+    cout << " : " << ComplexityClasses::travelingSalesman(cityGraph, 8) << endl;
+    cout << "-: " << ComplexityClasses::travelingSalesmanHeldKarp(cityGraph, 8) << endl;
+    mt19937 cityGen(42);
+    uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    vector<LocalSearchTsp::Point> manyCities(10000);
+    for (LocalSearchTsp::Point& city : manyCities) city = { coordinate(cityGen), coordinate(cityGen) };
+    auto tspStart = high_resolution_clock::now();
+    double tspLength = ComplexityClasses::travelingSalesmanLocalSearch(manyCities, 1000);
+    auto tspEnd = high_resolution_clock::now();
+    cout << " , 10000 :  " << (long long)tspLength << "  "
+        << duration_cast<milliseconds>(tspEnd - tspStart).count() << " " << endl;
+
+    // 
+    cout << "\n 2000 x 2000:" << endl;
+    vector<vector<int>> bigMaze(2000, vector<int>(2000, 1));
+    for (int row = 1; row < 2000; row += 2) {
+        //            
+        for (int col = 0; col < 2000; col++) bigMaze[row][col] = 0;
+        bigMaze[row][row % 4 == 1 ? 1999 : 0] = 1;
+    }
+    auto mazeStart = high_resolution_clock::now();
+    int mazePath = PracticalExamples::shortestPathInMaze(bigMaze, 0, 0, 1998, 0);
+    auto mazeEnd = high_resolution_clock::now();
+    cout << " : " << mazePath << "   "
+        << duration_cast<milliseconds>(mazeEnd - mazeStart).count() << " " << endl;
 
     //  
     cout << "\n :" << endl;
     for (int i = 0; i <= 6; i++) {
         cout << "C" << i << " = " << PracticalExamples::catalanNumber(i) << endl;
     }
+    cout << " : C30 = " << PracticalExamples::catalanNumberMemoized(30) << endl;
 
     //  
     cout << "\n    n=3:" << endl;
     PracticalExamples::generateParentheses(3, 0, 0, "");
+    cout << "  , n=3:" << endl;
+    PracticalExamples::generateParenthesesLazy(3);
+    cout << "  1000000  " << BalancedParentheses::count(15) << "  n=15: "
+        << BalancedParentheses(15, 1000000).current() << endl;
+
+    //  
+    cout << "\n {0, 1, 2} ():" << endl;
+    for (const vector<int>& permutation : LazyEnumerations::permutations(3)) {
+        for (int x : permutation) cout << x << " ";
+        cout << endl;
+    }
+    cout << "\n { 1, 2, 3 }   :" << endl;
+    RecursionAnalysis::printSubsetsGray({ 1, 2, 3 });
 
     //   
     RecursionAnalysis::analyzeRecurrence();
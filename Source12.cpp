@@ -1,12 +1,39 @@
+#pragma once
+
 #include <iostream>
 #include <vector>
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <stack>
+#include <string>
+#include <functional>
 
 using namespace std;
 using namespace chrono;
 
+// ====================    ====================
+
+//    .    
+// (. BenchmarkRun  Source24.cpp), report   
+class BenchmarkSink {
+public:
+    using Handler = function<void(const string& benchmark, const string& caseName,
+        const string& shape, double microseconds)>;
+
+    static Handler& handler() {
+        static Handler current;
+        return current;
+    }
+
+    static void report(const string& benchmark, const string& caseName,
+        const string& shape, double microseconds) {
+        if (handler()) {
+            handler()(benchmark, caseName, shape, microseconds);
+        }
+    }
+};
+
 class SearchAlgorithms {
 public:
     //   - O(n)
@@ -807,6 +834,19 @@ private:
         return duration_cast<microseconds>(end - start).count();
     }
 
+    //         . 
+    //   volatile:         
+    template<typename Func>
+    static double nsPerSearch(Func func, const vector<int>& targets) {
+        auto start = high_resolution_clock::now();
+        long long sink = 0;
+        for (int target : targets) sink += func(target);
+        auto end = high_resolution_clock::now();
+        volatile long long guard = sink;
+        (void)guard;
+        return duration_cast<nanoseconds>(end - start).count() / static_cast<double>(targets.size());
+    }
+
 public:
     //   
     static void compareSortingAlgorithms() {
@@ -824,19 +864,22 @@ public:
 
             //    
             cout << "\n1.  :" << endl;
-            testSortingOnArray(randomArr, size);
+            testSortingOnArray(randomArr, size, "random");
 
             //     
             cout << "\n2.   :" << endl;
-            testSortingOnArray(almostSortedArr, size);
+            testSortingOnArray(almostSortedArr, size, "almost_sorted");
 
             //     
             cout << "\n3.   :" << endl;
-            testSortingOnArray(reverseArr, size);
+            testSortingOnArray(reverseArr, size, "reverse");
         }
     }
 
-    static void testSortingOnArray(vector<int> arr, int size) {
+    // kind -   ,       
+    static void testSortingOnArray(vector<int> arr, int size, const string& kind = "custom") {
+        const string benchmark = "compareSortingAlgorithms";
+        const string shape = "n=" + to_string(size) + ";" + kind;
         vector<int> arrCopy;
 
         //  
@@ -845,6 +888,7 @@ public:
             long long time = measureTime([](vector<int>& a) {
                 BubbleSort::bubbleSortOptimized(a);
                 }, arrCopy);
+            BenchmarkSink::report(benchmark, "bubble", shape, (double)time);
             cout << "   : " << time << " , "
                 << (isSorted(arrCopy) ? "?" : "?") << endl;
         }
@@ -854,6 +898,7 @@ public:
         long long time = measureTime([size](vector<int>& a) {
             MergeSort::mergeSort(a, 0, size - 1);
             }, arrCopy);
+        BenchmarkSink::report(benchmark, "merge", shape, (double)time);
         cout << "   : " << time << " , "
             << (isSorted(arrCopy) ? "?" : "?") << endl;
 
@@ -862,6 +907,7 @@ public:
         time = measureTime([size](vector<int>& a) {
             QuickSort::quickSort(a, 0, size - 1);
             }, arrCopy);
+        BenchmarkSink::report(benchmark, "quick", shape, (double)time);
         cout << "   : " << time << " , "
             << (isSorted(arrCopy) ? "?" : "?") << endl;
 
@@ -870,6 +916,7 @@ public:
         time = measureTime([size](vector<int>& a) {
             QuickSort::quickSortMedianOfThree(a, 0, size - 1);
             }, arrCopy);
+        BenchmarkSink::report(benchmark, "quick_median3", shape, (double)time);
         cout << "    ( ): " << time << " , "
             << (isSorted(arrCopy) ? "?" : "?") << endl;
     }
@@ -877,6 +924,7 @@ public:
     //   
     static void compareSearchAlgorithms() {
         cout << "\n===    ===" << endl;
+        const string benchmark = "compareSearchAlgorithms";
 
         vector<int> sizes = { 1000, 10000, 100000, 1000000 };
 
@@ -887,30 +935,38 @@ public:
             vector<int> arr = generateRandomArray(size);
             sort(arr.begin(), arr.end());
 
-            //     
+            //     :   
+            // ,   ,      
             random_device rd;
             mt19937 gen(rd());
             uniform_int_distribution<int> dis(0, size - 1);
-            int target = arr[dis(gen)];
+            vector<int> targets(100000);
+            for (int& target : targets) target = arr[dis(gen)];
+            vector<int> linearTargets(targets.begin(), targets.begin() + max(10, 10000000 / size));
+            //   - ,   - ,    
+            const string shape = "n=" + to_string(size);
 
             //    (  )
             vector<int> unsortedArr = generateRandomArray(size);
-            long long time = measureTime([&](vector<int>& a) {
-                SearchAlgorithms::linearSearch(a, target);
-                }, unsortedArr);
-            cout << "    (): " << time << " " << endl;
+            double time = nsPerSearch([&](int target) {
+                return SearchAlgorithms::linearSearch(unsortedArr, target);
+                }, linearTargets);
+            BenchmarkSink::report(benchmark, "linear", shape, time / 1000.0);
+            cout << "    (): " << time << " " << endl;
 
             //    ()
-            time = measureTime([&](vector<int>& a) {
-                BinarySearchAlgorithms::binarySearchIterative(a, target);
-                }, arr);
-            cout << "    (): " << time << " " << endl;
+            time = nsPerSearch([&](int target) {
+                return BinarySearchAlgorithms::binarySearchIterative(arr, target);
+                }, targets);
+            BenchmarkSink::report(benchmark, "binary_iterative", shape, time / 1000.0);
+            cout << "    (): " << time << " " << endl;
 
             //    ()
-            time = measureTime([&](vector<int>& a) {
-                BinarySearchAlgorithms::binarySearchRecursive(a, target, 0, size - 1);
-                }, arr);
-            cout << "    (): " << time << " " << endl;
+            time = nsPerSearch([&](int target) {
+                return BinarySearchAlgorithms::binarySearchRecursive(arr, target, 0, size - 1);
+                }, targets);
+            BenchmarkSink::report(benchmark, "binary_recursive", shape, time / 1000.0);
+            cout << "    (): " << time << " " << endl;
         }
     }
 
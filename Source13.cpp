@@ -0,0 +1,492 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <climits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+//
+//  (  FastPFor):
+//  -      128 ;
+//  -       (),
+//      b ,  b -    ;
+//  -  "":  4k+l    l,
+//      SSE2-   4 ;
+//  -         ,
+//          .
+
+class CompressedSortedArray {
+public:
+    static constexpr int BLOCK_SIZE = 128;
+
+private:
+    static constexpr int LANES = 4;                           //   SSE-
+    static constexpr int VALUES_PER_LANE = BLOCK_SIZE / LANES; // 32   
+
+    int count = 0;                  //  
+    vector<int> blockFirst;         //  :   
+    vector<int> blockLast;          //  :  () 
+    vector<uint32_t> blockOffset;   //    packed ( 32- )
+    vector<uint8_t> bitWidth;       //      (0..32)
+    vector<uint32_t> packed;        //    
+
+    //  ,    
+    static int bitsNeeded(uint32_t value) {
+        int bits = 0;
+        while (value != 0) {
+            bits++;
+            value >>= 1;
+        }
+        return bits;
+    }
+
+    //  128   b     (4 * b )
+    static void packBlock(const uint32_t* deltas, int b, uint32_t* out) {
+        memset(out, 0, sizeof(uint32_t) * LANES * b);
+
+        for (int k = 0; k < VALUES_PER_LANE; k++) {
+            int pos = k * b;
+            int word = pos / 32;
+            int offset = pos % 32;
+
+            for (int lane = 0; lane < LANES; lane++) {
+                uint32_t value = deltas[k * LANES + lane];
+                out[word * LANES + lane] |= value << offset;
+
+                //       -   
+                if (offset + b > 32) {
+                    out[(word + 1) * LANES + lane] |= value >> (32 - offset);
+                }
+            }
+        }
+    }
+
+    //   (   SSE2)
+    static void unpackBlockScalar(const uint32_t* in, int b, uint32_t* out) {
+        uint32_t mask = (b == 32) ? 0xFFFFFFFFu : ((1u << b) - 1);
+
+        for (int k = 0; k < VALUES_PER_LANE; k++) {
+            int pos = k * b;
+            int word = pos / 32;
+            int offset = pos % 32;
+
+            for (int lane = 0; lane < LANES; lane++) {
+                uint32_t value = in[word * LANES + lane] >> offset;
+                if (offset + b > 32) {
+                    value |= in[(word + 1) * LANES + lane] << (32 - offset);
+                }
+                out[k * LANES + lane] = value & mask;
+            }
+        }
+    }
+
+#ifdef HAS_SSE2
+    // SIMD-: 4    
+    static void unpackBlockSimd(const uint32_t* in, int b, uint32_t* out) {
+        const __m128i* src = reinterpret_cast<const __m128i*>(in);
+        __m128i* dst = reinterpret_cast<__m128i*>(out);
+        __m128i mask = _mm_set1_epi32(b == 32 ? -1 : static_cast<int>((1u << b) - 1));
+
+        __m128i current = _mm_loadu_si128(src++);
+        int offset = 0;
+
+        for (int k = 0; k < VALUES_PER_LANE; k++) {
+            __m128i value = _mm_srl_epi32(current, _mm_cvtsi32_si128(offset));
+
+            if (offset + b > 32) {
+                //     
+                __m128i next = _mm_loadu_si128(src++);
+                value = _mm_or_si128(value, _mm_sll_epi32(next, _mm_cvtsi32_si128(32 - offset)));
+                current = next;
+                offset = offset + b - 32;
+            }
+            else if (offset + b == 32) {
+                //    -  ,   
+                if (k + 1 < VALUES_PER_LANE) {
+                    current = _mm_loadu_si128(src++);
+                }
+                offset = 0;
+            }
+            else {
+                offset += b;
+            }
+
+            _mm_store_si128(dst + k, _mm_and_si128(value, mask));
+        }
+    }
+
+    //     SSE-    
+    static void prefixSumSimd(uint32_t* values, int first) {
+        __m128i* data = reinterpret_cast<__m128i*>(values);
+        __m128i carry = _mm_set1_epi32(first);
+
+        for (int k = 0; k < VALUES_PER_LANE; k++) {
+            __m128i x = _mm_load_si128(data + k);
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            _mm_store_si128(data + k, x);
+            carry = _mm_shuffle_epi32(x, 0xFF);  //     
+        }
+    }
+#endif
+
+    static void prefixSumScalar(uint32_t* values, int first) {
+        uint32_t running = static_cast<uint32_t>(first);
+        for (int i = 0; i < BLOCK_SIZE; i++) {
+            running += values[i];
+            values[i] = running;
+        }
+    }
+
+public:
+    CompressedSortedArray() = default;
+
+    //    ( ) 
+    explicit CompressedSortedArray(const vector<int>& sorted) {
+        build(sorted);
+    }
+
+    void build(const vector<int>& sorted) {
+        for (size_t i = 1; i < sorted.size(); i++) {
+            if (sorted[i] < sorted[i - 1]) {
+                throw invalid_argument("     ");
+            }
+        }
+
+        count = static_cast<int>(sorted.size());
+        int blocks = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        blockFirst.assign(blocks, 0);
+        blockLast.assign(blocks, 0);
+        blockOffset.assign(blocks, 0);
+        bitWidth.assign(blocks, 0);
+        packed.clear();
+
+        uint32_t deltas[BLOCK_SIZE];
+
+        for (int block = 0; block < blocks; block++) {
+            int start = block * BLOCK_SIZE;
+            int end = min(start + BLOCK_SIZE, count);
+
+            blockFirst[block] = sorted[start];
+            blockLast[block] = sorted[end - 1];
+
+            // ;     
+            uint32_t maxDelta = 0;
+            for (int i = 0; i < BLOCK_SIZE; i++) {
+                int idx = start + i;
+                if (i == 0 || idx >= end) {
+                    deltas[i] = 0;
+                }
+                else {
+                    deltas[i] = static_cast<uint32_t>(sorted[idx]) - static_cast<uint32_t>(sorted[idx - 1]);
+                }
+                maxDelta = max(maxDelta, deltas[i]);
+            }
+
+            int b = bitsNeeded(maxDelta);
+            bitWidth[block] = static_cast<uint8_t>(b);
+            blockOffset[block] = static_cast<uint32_t>(packed.size());
+
+            packed.resize(packed.size() + LANES * b);
+            if (b > 0) {
+                packBlock(deltas, b, packed.data() + blockOffset[block]);
+            }
+        }
+    }
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    int blockCount() const { return static_cast<int>(blockFirst.size()); }
+
+    //     (    )
+    int blockLength(int block) const {
+        return min(BLOCK_SIZE, count - block * BLOCK_SIZE);
+    }
+
+    //       128  (   16 )
+    void decodeBlock(int block, int* out) const {
+        uint32_t* values = reinterpret_cast<uint32_t*>(out);
+        int b = bitWidth[block];
+
+        if (b == 0) {
+            fill(values, values + BLOCK_SIZE, 0u);
+        }
+        else {
+#ifdef HAS_SSE2
+            unpackBlockSimd(packed.data() + blockOffset[block], b, values);
+#else
+            unpackBlockScalar(packed.data() + blockOffset[block], b, values);
+#endif
+        }
+
+#ifdef HAS_SSE2
+        prefixSumSimd(values, blockFirst[block]);
+#else
+        prefixSumScalar(values, blockFirst[block]);
+#endif
+    }
+
+    //  
+    vector<int> decode() const {
+        vector<int> result(count);
+        alignas(16) int buffer[BLOCK_SIZE];
+
+        for (int block = 0; block < blockCount(); block++) {
+            decodeBlock(block, buffer);
+            copy(buffer, buffer + blockLength(block), result.begin() + block * BLOCK_SIZE);
+        }
+        return result;
+    }
+
+    //    - O(1)  
+    int at(int index) const {
+        if (index < 0 || index >= count) {
+            throw out_of_range("  ");
+        }
+        alignas(16) int buffer[BLOCK_SIZE];
+        decodeBlock(index / BLOCK_SIZE, buffer);
+        return buffer[index % BLOCK_SIZE];
+    }
+
+    //  :    >= target ( size(),   )
+    //      +   
+    int lowerBound(int target) const {
+        auto it = std::lower_bound(blockLast.begin(), blockLast.end(), target);
+        if (it == blockLast.end()) return count;
+
+        int block = static_cast<int>(it - blockLast.begin());
+        if (blockFirst[block] >= target) return block * BLOCK_SIZE;
+
+        alignas(16) int buffer[BLOCK_SIZE];
+        decodeBlock(block, buffer);
+        int length = blockLength(block);
+        return block * BLOCK_SIZE + static_cast<int>(std::lower_bound(buffer, buffer + length, target) - buffer);
+    }
+
+    //  
+    bool contains(int target) const {
+        auto it = std::lower_bound(blockLast.begin(), blockLast.end(), target);
+        if (it == blockLast.end()) return false;
+
+        int block = static_cast<int>(it - blockLast.begin());
+        if (*it == target || blockFirst[block] == target) return true;
+        if (blockFirst[block] > target) return false;  //     
+
+        alignas(16) int buffer[BLOCK_SIZE];
+        decodeBlock(block, buffer);
+        return binary_search(buffer, buffer + blockLength(block), target);
+    }
+
+    //    BinarySearchAlgorithms:     -1
+    int find(int target) const {
+        int pos = lowerBound(target);
+        if (pos < count && at(pos) == target) return pos;
+        return -1;
+    }
+
+    // ====================  ====================
+
+    //  :      
+    class Iterator {
+    private:
+        const CompressedSortedArray* owner;
+        int index;
+        alignas(16) int buffer[BLOCK_SIZE];
+
+        void loadBlock() {
+            if (index < owner->count && index % BLOCK_SIZE == 0) {
+                owner->decodeBlock(index / BLOCK_SIZE, buffer);
+            }
+        }
+
+    public:
+        Iterator(const CompressedSortedArray* arr, int start) : owner(arr), index(start) {
+            if (index < owner->count) {
+                owner->decodeBlock(index / BLOCK_SIZE, buffer);
+            }
+        }
+
+        int operator*() const { return buffer[index % BLOCK_SIZE]; }
+
+        Iterator& operator++() {
+            index++;
+            loadBlock();
+            return *this;
+        }
+
+        int position() const { return index; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, count); }
+
+    // ,     >= target
+    Iterator seek(int target) const { return Iterator(this, lowerBound(target)); }
+
+    //       ( range-for)
+    template<typename Func>
+    void forEach(Func func) const {
+        alignas(16) int buffer[BLOCK_SIZE];
+        for (int block = 0; block < blockCount(); block++) {
+            decodeBlock(block, buffer);
+            int length = blockLength(block);
+            for (int i = 0; i < length; i++) {
+                func(buffer[i]);
+            }
+        }
+    }
+
+    // ====================  ====================
+
+    //     ( +  )
+    size_t memoryBytes() const {
+        return packed.size() * sizeof(uint32_t)
+            + blockFirst.size() * sizeof(int)
+            + blockLast.size() * sizeof(int)
+            + blockOffset.size() * sizeof(uint32_t)
+            + bitWidth.size() * sizeof(uint8_t);
+    }
+
+    double bitsPerValue() const {
+        return count == 0 ? 0.0 : memoryBytes() * 8.0 / count;
+    }
+
+    //    ,  vector<int>
+    double compressionRatio() const {
+        return memoryBytes() == 0 ? 1.0 : static_cast<double>(count) * sizeof(int) / memoryBytes();
+    }
+};
+
+// ====================     ====================
+
+class CompressedArrayBenchmark {
+private:
+    //      
+    static vector<int> generateSortedWithGaps(int size, int maxGap, mt19937& gen) {
+        uniform_int_distribution<int> dis(0, maxGap);
+        vector<int> arr(size);
+        int value = 0;
+        for (int i = 0; i < size; i++) {
+            value += dis(gen);
+            arr[i] = value;
+        }
+        return arr;
+    }
+
+public:
+    //     
+    static bool verify(const vector<int>& arr, const CompressedSortedArray& compressed, const vector<int>& queries) {
+        if (compressed.decode() != arr) return false;
+
+        int index = 0;
+        for (auto it = compressed.begin(); it != compressed.end(); ++it) {
+            if (*it != arr[index++]) return false;
+        }
+
+        for (int q : queries) {
+            int expected = static_cast<int>(lower_bound(arr.begin(), arr.end(), q) - arr.begin());
+            if (compressed.lowerBound(q) != expected) return false;
+            if (compressed.contains(q) != binary_search(arr.begin(), arr.end(), q)) return false;
+        }
+        return true;
+    }
+
+    static void compareWithUncompressed() {
+        cout << "\n===   vs BinarySearchAlgorithms ===" << endl;
+
+        mt19937 gen(42);
+        vector<int> sizes = { 10000, 1000000, 10000000 };
+        vector<int> gaps = { 4, 64, 4096 };
+        const int queryCount = 1000000;
+
+        for (int size : sizes) {
+            for (int maxGap : gaps) {
+                //   ,     int
+                maxGap = min(maxGap, INT_MAX / size);
+                vector<int> arr = generateSortedWithGaps(size, maxGap, gen);
+                CompressedSortedArray compressed(arr);
+
+                //   -  ,  - 
+                uniform_int_distribution<int> pick(0, size - 1);
+                uniform_int_distribution<int> any(arr.front(), arr.back());
+                vector<int> queries(queryCount);
+                for (int i = 0; i < queryCount; i++) {
+                    queries[i] = (i % 2 == 0) ? arr[pick(gen)] : any(gen);
+                }
+
+                cout << "\n--- n = " << size << ",   = " << maxGap << " ---" << endl;
+                cout << "  : " << arr.size() * sizeof(int) << "  -> "
+                    << compressed.memoryBytes() << "  ( " << compressed.compressionRatio()
+                    << "x, " << compressed.bitsPerValue() << " /)" << endl;
+                cout << "  : " << (verify(arr, compressed, vector<int>(queries.begin(), queries.begin() + 10000)) ? "OK" : "") << endl;
+
+                long long found = 0;
+                auto start = high_resolution_clock::now();
+                for (int q : queries) {
+                    found += BinarySearchAlgorithms::binarySearchIterative(arr, q) != -1;
+                }
+                auto end = high_resolution_clock::now();
+                double plainNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+                long long foundCompressed = 0;
+                start = high_resolution_clock::now();
+                for (int q : queries) {
+                    foundCompressed += compressed.contains(q);
+                }
+                end = high_resolution_clock::now();
+                double compressedNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+                long long positionSum = 0;
+                start = high_resolution_clock::now();
+                for (int q : queries) {
+                    positionSum += BinarySearchAlgorithms::binarySearchInsertPosition(arr, q);
+                }
+                end = high_resolution_clock::now();
+                double plainLowerNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+                long long compressedPositionSum = 0;
+                start = high_resolution_clock::now();
+                for (int q : queries) {
+                    compressedPositionSum += compressed.lowerBound(q);
+                }
+                end = high_resolution_clock::now();
+                double compressedLowerNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+                cout << "  binarySearchIterative: " << plainNs << " / ( " << found << ")" << endl;
+                cout << "  contains ():     " << compressedNs << " / ( " << foundCompressed << ")" << endl;
+                cout << "  binarySearchInsertPosition: " << plainLowerNs << " /" << endl;
+                cout << "  lowerBound ():        " << compressedLowerNs << " /"
+                    << " (  " << positionSum << " / " << compressedPositionSum << ")" << endl;
+
+                long long sum = 0;
+                start = high_resolution_clock::now();
+                compressed.forEach([&sum](int value) { sum += value; });
+                end = high_resolution_clock::now();
+                cout << "   : " << duration_cast<microseconds>(end - start).count() << " " << endl;
+            }
+        }
+    }
+};
\ No newline at end of file
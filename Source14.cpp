@@ -0,0 +1,357 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================     ====================
+//
+//   -    ( ).
+//      ,  
+//   .   :
+//  - : min(a.size(), b.size());
+//  - : a.size() + b.size();
+//  -  a \ b: a.size().
+//      out == a.data() ( " ").
+
+class SortedSetOperations {
+public:
+    //       GALLOP_RATIO    -
+    //   ,   SIMD-
+    static const size_t GALLOP_RATIO = 64;
+
+    // ====================    ====================
+
+    // :   >= target,   from - O(log d), d -   
+    static size_t gallop(span<const int> arr, size_t from, int target) {
+        size_t n = arr.size();
+        if (from >= n || arr[from] >= target) return from;
+
+        //  ,    target
+        size_t step = 1;
+        size_t prev = from;
+        size_t curr = from + 1;
+        while (curr < n && arr[curr] < target) {
+            prev = curr;
+            step *= 2;
+            curr = from + step;
+        }
+
+        //    (prev, min(curr, n)]
+        size_t hi = min(curr, n);
+        return static_cast<size_t>(lower_bound(arr.begin() + prev + 1, arr.begin() + hi, target) - arr.begin());
+    }
+
+    // ====================  ====================
+
+    //   - O(n + m)
+    static size_t intersectScalar(span<const int> a, span<const int> b, int* out) {
+        size_t i = 0, j = 0, k = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) {
+                i++;
+            }
+            else if (a[i] > b[j]) {
+                j++;
+            }
+            else {
+                out[k++] = a[i];
+                i++;
+                j++;
+            }
+        }
+        return k;
+    }
+
+    // :          - O(n log(m/n))
+    static size_t intersectGalloping(span<const int> small, span<const int> large, int* out) {
+        size_t k = 0;
+        size_t pos = 0;
+        for (size_t i = 0; i < small.size(); i++) {
+            pos = gallop(large, pos, small[i]);
+            if (pos == large.size()) break;
+            if (large[pos] == small[i]) {
+                out[k++] = small[i];
+                pos++;
+            }
+        }
+        return k;
+    }
+
+    //  SIMD- "  ":   4  a
+    //   4    b (16   4 )
+    static size_t intersectSimd(span<const int> a, span<const int> b, int* out) {
+        size_t i = 0, j = 0, k = 0;
+
+#ifdef HAS_SSE2
+        size_t na = a.size() & ~static_cast<size_t>(3);
+        size_t nb = b.size() & ~static_cast<size_t>(3);
+
+        while (i < na && j < nb) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data() + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.data() + j));
+
+            __m128i eq = _mm_cmpeq_epi32(va, vb);
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x39)));  //   1
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x4E)));  //   2
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, 0x93)));  //   3
+
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+
+            //    a (  ,  out == a )
+            int aMax = a[i + 3];
+            int bMax = b[j + 3];
+            while (mask != 0) {
+                int bit = 0;
+                while (((mask >> bit) & 1) == 0) bit++;
+                out[k++] = a[i + bit];
+                mask &= mask - 1;
+            }
+
+            if (aMax <= bMax) i += 4;
+            if (bMax <= aMax) j += 4;
+        }
+#endif
+
+        //  -  
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) {
+                i++;
+            }
+            else if (a[i] > b[j]) {
+                j++;
+            }
+            else {
+                out[k++] = a[i];
+                i++;
+                j++;
+            }
+        }
+        return k;
+    }
+
+    //      
+    static size_t intersect(span<const int> a, span<const int> b, int* out) {
+        if (a.empty() || b.empty()) return 0;
+
+        if (a.size() * GALLOP_RATIO <= b.size()) {
+            return intersectGalloping(a, b, out);
+        }
+        if (b.size() * GALLOP_RATIO <= a.size()) {
+            return intersectGalloping(b, a, out);
+        }
+        return intersectSimd(a, b, out);
+    }
+
+    // ====================  ====================
+
+    //    - O(n + m)
+    static size_t unite(span<const int> a, span<const int> b, int* out) {
+        size_t i = 0, j = 0, k = 0;
+        while (i < a.size() && j < b.size()) {
+            int x = a[i];
+            int y = b[j];
+            out[k++] = min(x, y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+        while (i < a.size()) out[k++] = a[i++];
+        while (j < b.size()) out[k++] = b[j++];
+        return k;
+    }
+
+    // ====================  ====================
+
+    // a \ b:  a,    b
+    static size_t difference(span<const int> a, span<const int> b, int* out) {
+        size_t k = 0;
+
+        if (a.size() * GALLOP_RATIO <= b.size()) {
+            // a  -       b
+            size_t pos = 0;
+            for (size_t i = 0; i < a.size(); i++) {
+                pos = gallop(b, pos, a[i]);
+                if (pos == b.size() || b[pos] != a[i]) {
+                    out[k++] = a[i];
+                }
+            }
+            return k;
+        }
+
+        if (b.size() * GALLOP_RATIO <= a.size()) {
+            // b  -   a   b
+            size_t pos = 0;
+            for (size_t j = 0; j < b.size(); j++) {
+                size_t next = gallop(a, pos, b[j]);
+                copy(a.begin() + pos, a.begin() + next, out + k);
+                k += next - pos;
+                pos = (next < a.size() && a[next] == b[j]) ? next + 1 : next;
+            }
+            copy(a.begin() + pos, a.end(), out + k);
+            return k + (a.size() - pos);
+        }
+
+        size_t i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) {
+                out[k++] = a[i++];
+            }
+            else if (a[i] > b[j]) {
+                j++;
+            }
+            else {
+                i++;
+                j++;
+            }
+        }
+        while (i < a.size()) out[k++] = a[i++];
+        return k;
+    }
+
+    // ==================== K-  ====================
+
+    //   :       
+    //  ,      .
+    //  out     .
+    static size_t intersectMany(const vector<span<const int>>& lists, int* out) {
+        if (lists.empty()) return 0;
+
+        vector<size_t> order(lists.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = i;
+        sort(order.begin(), order.end(), [&lists](size_t x, size_t y) {
+            return lists[x].size() < lists[y].size();
+            });
+
+        span<const int> first = lists[order[0]];
+        copy(first.begin(), first.end(), out);
+        size_t count = first.size();
+
+        for (size_t idx = 1; idx < order.size() && count > 0; idx++) {
+            count = intersect(span<const int>(out, count), lists[order[idx]], out);
+        }
+        return count;
+    }
+
+    //    vector<int>
+    static vector<int> intersect(const vector<int>& a, const vector<int>& b) {
+        vector<int> result(min(a.size(), b.size()));
+        result.resize(intersect(span<const int>(a), span<const int>(b), result.data()));
+        return result;
+    }
+
+    static vector<int> unite(const vector<int>& a, const vector<int>& b) {
+        vector<int> result(a.size() + b.size());
+        result.resize(unite(span<const int>(a), span<const int>(b), result.data()));
+        return result;
+    }
+
+    static vector<int> difference(const vector<int>& a, const vector<int>& b) {
+        vector<int> result(a.size());
+        result.resize(difference(span<const int>(a), span<const int>(b), result.data()));
+        return result;
+    }
+};
+
+// ====================      ====================
+
+class SetOperationsBenchmark {
+private:
+    //      size   [0, universe)
+    static vector<int> generateSet(int size, int universe, mt19937& gen) {
+        vector<int> values(size);
+        uniform_int_distribution<int> dis(0, universe - 1);
+        for (int& v : values) v = dis(gen);
+        sort(values.begin(), values.end());
+        values.erase(unique(values.begin(), values.end()), values.end());
+        return values;
+    }
+
+    //  :      
+    static size_t intersectByBinarySearch(const vector<int>& small, const vector<int>& large, int* out) {
+        size_t k = 0;
+        for (int x : small) {
+            if (BinarySearchAlgorithms::binarySearchIterative(large, x) != -1) {
+                out[k++] = x;
+            }
+        }
+        return k;
+    }
+
+    template<typename Func>
+    static double measureMicroseconds(Func func, int repeats) {
+        auto start = high_resolution_clock::now();
+        for (int r = 0; r < repeats; r++) func();
+        auto end = high_resolution_clock::now();
+        return duration_cast<microseconds>(end - start).count() / static_cast<double>(repeats);
+    }
+
+public:
+    static void compareIntersection() {
+        cout << "\n===    ===" << endl;
+
+        mt19937 gen(7);
+        const int universe = 50000000;
+        vector<pair<int, int>> shapes = { {1000000, 1000000}, {100000, 1000000}, {10000, 1000000}, {1000, 1000000} };
+
+        for (auto [smallSize, largeSize] : shapes) {
+            vector<int> small = generateSet(smallSize, universe, gen);
+            vector<int> large = generateSet(largeSize, universe, gen);
+            vector<int> out(small.size());
+            size_t expected = 0, got = 0;
+
+            cout << "\n--- " << small.size() << " x " << large.size() << " ---" << endl;
+
+            double tBinary = measureMicroseconds([&]() {
+                expected = intersectByBinarySearch(small, large, out.data());
+                }, 5);
+            double tScalar = measureMicroseconds([&]() {
+                got = SortedSetOperations::intersectScalar(small, large, out.data());
+                }, 5);
+            double tSimd = measureMicroseconds([&]() {
+                got = SortedSetOperations::intersectSimd(small, large, out.data());
+                }, 5);
+            double tGallop = measureMicroseconds([&]() {
+                got = SortedSetOperations::intersectGalloping(small, large, out.data());
+                }, 5);
+            double tAuto = measureMicroseconds([&]() {
+                got = SortedSetOperations::intersect(span<const int>(small), span<const int>(large), out.data());
+                }, 5);
+
+            cout << "  binarySearchIterative  : " << tBinary << " " << endl;
+            cout << "  :                       " << tScalar << " " << endl;
+            cout << "  SIMD :                    " << tSimd << " " << endl;
+            cout << "  :                         " << tGallop << " " << endl;
+            cout << "  :                     " << tAuto << "  ("
+                << (got == expected ? "OK" : "") << ", " << got << " )" << endl;
+        }
+
+        // K- 
+        vector<vector<int>> lists;
+        for (int size : { 2000000, 500000, 1000000, 50000 }) {
+            lists.push_back(generateSet(size, 10000000, gen));
+        }
+        vector<span<const int>> spans(lists.begin(), lists.end());
+        vector<int> out(lists[3].size());
+        size_t count = 0;
+        double tMany = measureMicroseconds([&]() {
+            count = SortedSetOperations::intersectMany(spans, out.data());
+            }, 5);
+        cout << "\n--- K-  4 : " << tMany << " , " << count << "  ---" << endl;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,623 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <stdexcept>
+#include <filesystem>
+#include <atomic>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================     ====================
+//
+//          (mmap) 
+//  :    page cache, 
+//      .
+//
+//  [0 .. 4096)           SortedFileHeader ( - )
+//  [dataOffset ..)      count  int32 (little-endian),   alignment
+//  [indexOffset ..)      :  indexStride- 
+
+struct SortedFileHeader {
+    static const uint32_t MAGIC = 0x41535242;   // "BRSA"
+    static const uint32_t VERSION = 1;
+    static const uint32_t FLAG_HAS_INDEX = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;      // sizeof(SortedFileHeader) -   
+    uint32_t flags;
+    uint64_t count;           //  
+    uint64_t alignment;       //  
+    uint64_t dataOffset;
+    uint64_t dataChecksum;
+    uint64_t indexOffset;
+    uint64_t indexCount;
+    uint64_t indexStride;
+    uint64_t indexChecksum;
+    uint64_t headerChecksum;  //     
+};
+
+class SortedFileChecksum {
+public:
+    // 64-     FNV-1a,   8   
+    static uint64_t compute(const void* data, size_t bytes) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        const uint64_t prime = 0x100000001b3ULL;
+
+        size_t i = 0;
+        for (; i + 8 <= bytes; i += 8) {
+            uint64_t word;
+            memcpy(&word, p + i, 8);
+            hash = (hash ^ word) * prime;
+            hash ^= hash >> 29;
+        }
+        for (; i < bytes; i++) {
+            hash = (hash ^ p[i]) * prime;
+        }
+        return hash ^ bytes;
+    }
+
+    static uint64_t header(const SortedFileHeader& h) {
+        return compute(&h, offsetof(SortedFileHeader, headerChecksum));
+    }
+};
+
+// ====================  ====================
+
+class SortedArrayFileWriter {
+public:
+    struct Options {
+        bool withIndex = true;
+        uint64_t indexStride = 256;   //  256- : ~16    1  
+        uint64_t alignment = 4096;    //  4 ; 2  (2 << 20) -  huge pages
+    };
+
+    static void write(const string& path, span<const int> sorted) {
+        write(path, sorted, Options());
+    }
+
+    static void write(const string& path, span<const int> sorted, const Options& options) {
+        if (options.alignment < 4096 || (options.alignment & (options.alignment - 1)) != 0) {
+            throw invalid_argument("       4096");
+        }
+        if (options.withIndex && options.indexStride == 0) {
+            throw invalid_argument("    ");
+        }
+        for (size_t i = 1; i < sorted.size(); i++) {
+            if (sorted[i] < sorted[i - 1]) {
+                throw invalid_argument("     ");
+            }
+        }
+
+        vector<int> index;
+        if (options.withIndex) {
+            for (size_t i = 0; i < sorted.size(); i += options.indexStride) {
+                index.push_back(sorted[i]);
+            }
+        }
+
+        SortedFileHeader header = {};
+        header.magic = SortedFileHeader::MAGIC;
+        header.version = SortedFileHeader::VERSION;
+        header.headerSize = sizeof(SortedFileHeader);
+        header.flags = options.withIndex ? SortedFileHeader::FLAG_HAS_INDEX : 0;
+        header.count = sorted.size();
+        header.alignment = options.alignment;
+        header.dataOffset = alignUp(sizeof(SortedFileHeader), options.alignment);
+        header.dataChecksum = SortedFileChecksum::compute(sorted.data(), sorted.size_bytes());
+
+        uint64_t dataEnd = header.dataOffset + sorted.size_bytes();
+        if (options.withIndex) {
+            header.indexOffset = alignUp(dataEnd, 4096);
+            header.indexCount = index.size();
+            header.indexStride = options.indexStride;
+            header.indexChecksum = SortedFileChecksum::compute(index.data(), index.size() * sizeof(int));
+        }
+        header.headerChecksum = SortedFileChecksum::header(header);
+
+        //         : 
+        //    ,   .   
+        //  ( + ),      
+        string tempPath = path + ".tmp." + to_string(processId()) + "." + to_string(tempCounter()++);
+        try {
+            ofstream out(tempPath, ios::binary | ios::trunc);
+            if (!out) {
+                throw runtime_error("   : " + tempPath);
+            }
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            writePadding(out, header.dataOffset - sizeof(header));
+            out.write(reinterpret_cast<const char*>(sorted.data()), sorted.size_bytes());
+
+            if (options.withIndex) {
+                writePadding(out, header.indexOffset - dataEnd);
+                out.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(int));
+            }
+
+            out.close();
+            if (!out) {
+                throw runtime_error("  : " + tempPath);
+            }
+            replaceFile(tempPath, path);
+        }
+        catch (...) {
+            error_code ignored;
+            filesystem::remove(tempPath, ignored);
+            throw;
+        }
+    }
+
+private:
+    //  target  source  :   
+    //   ,     
+    static void replaceFile(const string& source, const string& target) {
+#ifdef _WIN32
+        if (!MoveFileExW(filesystem::path(source).c_str(), filesystem::path(target).c_str(),
+            MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+            throw runtime_error("   " + source + "  " + target);
+        }
+#else
+        error_code error;
+        filesystem::rename(source, target, error);
+        if (error) {
+            throw runtime_error("   " + source + "  " + target + ": " + error.message());
+        }
+#endif
+    }
+
+    static unsigned long processId() {
+#ifdef _WIN32
+        return GetCurrentProcessId();
+#else
+        return (unsigned long)getpid();
+#endif
+    }
+
+    static atomic<uint64_t>& tempCounter() {
+        static atomic<uint64_t> counter{ 0 };
+        return counter;
+    }
+
+    static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static void writePadding(ofstream& out, uint64_t bytes) {
+        static const char zeros[4096] = {};
+        while (bytes > 0) {
+            uint64_t chunk = min<uint64_t>(bytes, sizeof(zeros));
+            out.write(zeros, chunk);
+            bytes -= chunk;
+        }
+    }
+};
+
+// ====================     ====================
+
+// ,      .    
+// ,    mmap    .
+class MemoryMappedFile {
+public:
+    enum class AccessPattern { Normal, Random, Sequential };
+
+private:
+    const uint8_t* base = nullptr;
+    size_t mappedBytes = 0;
+
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+public:
+    MemoryMappedFile() = default;
+
+    explicit MemoryMappedFile(const string& path) {
+        open(path);
+    }
+
+    ~MemoryMappedFile() {
+        close();
+    }
+
+    //   ,   
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept {
+        *this = move(other);
+    }
+
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            swap(base, other.base);
+            swap(mappedBytes, other.mappedBytes);
+#ifdef _WIN32
+            swap(fileHandle, other.fileHandle);
+            swap(mappingHandle, other.mappingHandle);
+#endif
+        }
+        return *this;
+    }
+
+    void open(const string& path) {
+        close();
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            throw runtime_error("   : " + path);
+        }
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(fileHandle, &size);
+        mappedBytes = static_cast<size_t>(size.QuadPart);
+        if (mappedBytes == 0) {
+            close();
+            throw runtime_error(" : " + path);
+        }
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            close();
+            throw runtime_error("CreateFileMapping   : " + path);
+        }
+
+        base = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (base == nullptr) {
+            close();
+            throw runtime_error("MapViewOfFile   : " + path);
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error("   : " + path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            throw runtime_error("    : " + path);
+        }
+
+        // MAP_SHARED + PROT_READ:         page cache
+        void* ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  //      
+        if (ptr == MAP_FAILED) {
+            throw runtime_error("mmap   : " + path);
+        }
+        base = static_cast<const uint8_t*>(ptr);
+        mappedBytes = static_cast<size_t>(st.st_size);
+#endif
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (base != nullptr) UnmapViewOfFile(base);
+        if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (base != nullptr) munmap(const_cast<uint8_t*>(base), mappedBytes);
+#endif
+        base = nullptr;
+        mappedBytes = 0;
+    }
+
+    bool isOpen() const { return base != nullptr; }
+    const uint8_t* data() const { return base; }
+    size_t size() const { return mappedBytes; }
+
+    //      ( Windows  )
+    void advise(AccessPattern access, bool hugePages) {
+#ifndef _WIN32
+        void* addr = const_cast<uint8_t*>(base);
+
+        int advice = MADV_NORMAL;
+        if (access == AccessPattern::Random) advice = MADV_RANDOM;
+        if (access == AccessPattern::Sequential) advice = MADV_SEQUENTIAL;
+        madvise(addr, mappedBytes, advice);
+
+#ifdef MADV_HUGEPAGE
+        if (hugePages) {
+            madvise(addr, mappedBytes, MADV_HUGEPAGE);
+        }
+#endif
+#else
+        (void)access;
+        (void)hugePages;
+#endif
+    }
+
+    //    :      page fault
+    void prefault() {
+#ifndef _WIN32
+        madvise(const_cast<uint8_t*>(base), mappedBytes, MADV_WILLNEED);
+#endif
+        uint8_t touched = 0;
+        for (size_t offset = 0; offset < mappedBytes; offset += 4096) {
+            touched ^= base[offset];
+        }
+        volatile uint8_t sink = touched;
+        (void)sink;
+    }
+};
+
+// ====================   MMAP ====================
+
+class MappedSortedArray {
+public:
+    using AccessPattern = MemoryMappedFile::AccessPattern;
+
+    struct Options {
+        bool verifyData = false;        //       (  )
+        bool prefault = false;          //     -  
+        bool hugePages = false;         //     
+        AccessPattern access = AccessPattern::Random;  //   -  
+    };
+
+private:
+    MemoryMappedFile file;
+    const SortedFileHeader* header = nullptr;
+    span<const int> keys;
+    span<const int> index;
+
+    void unmap() {
+        file.close();
+        header = nullptr;
+        keys = {};
+        index = {};
+    }
+
+    void validate(const string& path, const Options& options) {
+        const uint8_t* base = file.data();
+        size_t mappedBytes = file.size();
+        if (mappedBytes < sizeof(SortedFileHeader)) {
+            throw runtime_error("    : " + path);
+        }
+
+        header = reinterpret_cast<const SortedFileHeader*>(base);
+        if (header->magic != SortedFileHeader::MAGIC) {
+            throw runtime_error("  : " + path);
+        }
+        if (header->version != SortedFileHeader::VERSION || header->headerSize != sizeof(SortedFileHeader)) {
+            throw runtime_error("  : " + to_string(header->version));
+        }
+        if (header->headerChecksum != SortedFileChecksum::header(*header)) {
+            throw runtime_error(" : " + path);
+        }
+
+        uint64_t dataEnd = header->dataOffset + header->count * sizeof(int);
+        if (header->dataOffset % 4096 != 0 || dataEnd > mappedBytes) {
+            throw runtime_error("     : " + path);
+        }
+        keys = span<const int>(reinterpret_cast<const int*>(base + header->dataOffset), header->count);
+
+        if (header->flags & SortedFileHeader::FLAG_HAS_INDEX) {
+            uint64_t indexEnd = header->indexOffset + header->indexCount * sizeof(int);
+            if (header->indexOffset < dataEnd || indexEnd > mappedBytes || header->indexStride == 0) {
+                throw runtime_error("  : " + path);
+            }
+            index = span<const int>(reinterpret_cast<const int*>(base + header->indexOffset), header->indexCount);
+        }
+
+        if (options.verifyData) {
+            if (SortedFileChecksum::compute(keys.data(), keys.size_bytes()) != header->dataChecksum) {
+                throw runtime_error("    : " + path);
+            }
+            if (!index.empty() && SortedFileChecksum::compute(index.data(), index.size_bytes()) != header->indexChecksum) {
+                throw runtime_error("    : " + path);
+            }
+        }
+    }
+
+    void applyHints(const Options& options) {
+        file.advise(options.access, options.hugePages);
+        if (options.prefault) {
+            file.prefault();
+        }
+    }
+
+public:
+    MappedSortedArray() = default;
+
+    MappedSortedArray(const string& path) {
+        open(path, Options());
+    }
+
+    MappedSortedArray(const string& path, const Options& options) {
+        open(path, options);
+    }
+
+    ~MappedSortedArray() {
+        unmap();
+    }
+
+    //   ,   
+    MappedSortedArray(const MappedSortedArray&) = delete;
+    MappedSortedArray& operator=(const MappedSortedArray&) = delete;
+
+    MappedSortedArray(MappedSortedArray&& other) noexcept {
+        *this = move(other);
+    }
+
+    MappedSortedArray& operator=(MappedSortedArray&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            swap(file, other.file);
+            swap(header, other.header);
+            swap(keys, other.keys);
+            swap(index, other.index);
+        }
+        return *this;
+    }
+
+    void open(const string& path, const Options& options) {
+        unmap();
+        file.open(path);
+        try {
+            validate(path, options);
+            applyHints(options);
+        }
+        catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    bool isOpen() const { return file.isOpen(); }
+
+    //      
+    span<const int> data() const { return keys; }
+    size_t size() const { return keys.size(); }
+    bool hasIndex() const { return !index.empty(); }
+    size_t fileBytes() const { return file.size(); }
+
+    //   >= target.    -    
+    // (   ),      indexStride 
+    size_t lowerBound(int target) const {
+        if (index.empty()) {
+            return static_cast<size_t>(std::lower_bound(keys.begin(), keys.end(), target) - keys.begin());
+        }
+
+        size_t stride = header->indexStride;
+        size_t slot = static_cast<size_t>(std::lower_bound(index.begin(), index.end(), target) - index.begin());
+
+        //     ((slot - 1) * stride, slot * stride]
+        size_t from = slot == 0 ? 0 : (slot - 1) * stride;
+        size_t to = min(keys.size(), slot * stride);
+        return static_cast<size_t>(std::lower_bound(keys.begin() + from, keys.begin() + to, target) - keys.begin());
+    }
+
+    bool contains(int target) const {
+        size_t pos = lowerBound(target);
+        return pos < keys.size() && keys[pos] == target;
+    }
+
+    //     -1 -   BinarySearchAlgorithms
+    long long find(int target) const {
+        size_t pos = lowerBound(target);
+        return (pos < keys.size() && keys[pos] == target) ? static_cast<long long>(pos) : -1;
+    }
+};
+
+// ====================     CSV ====================
+
+class MappedArrayBenchmark {
+private:
+    //   :  CSV  
+    static vector<int> loadFromCsv(const string& path) {
+        ifstream in(path);
+        vector<int> values;
+        string line;
+        while (getline(in, line)) {
+            stringstream ss(line);
+            string cell;
+            while (getline(ss, cell, ',')) {
+                if (!cell.empty()) values.push_back(stoi(cell));
+            }
+        }
+        sort(values.begin(), values.end());
+        return values;
+    }
+
+    static void saveCsv(const string& path, const vector<int>& values) {
+        ofstream out(path);
+        for (size_t i = 0; i < values.size(); i++) {
+            out << values[i] << ((i % 16 == 15) ? '\n' : ',');
+        }
+    }
+
+public:
+    static void compareStartup(int size = 5000000) {
+        cout << "\n=== : CSV vs    (n = " << size << ") ===" << endl;
+
+        mt19937 gen(11);
+        uniform_int_distribution<int> dis(0, 1 << 30);
+        vector<int> values(size);
+        for (int& v : values) v = dis(gen);
+
+        string csvPath = "sorted_array_bench.csv";
+        string binPath = "sorted_array_bench.bsa";
+        saveCsv(csvPath, values);
+
+        sort(values.begin(), values.end());
+        SortedArrayFileWriter::write(binPath, values);
+
+        auto start = high_resolution_clock::now();
+        vector<int> loaded = loadFromCsv(csvPath);
+        auto end = high_resolution_clock::now();
+        cout << "  CSV + : " << duration_cast<milliseconds>(end - start).count() << " , "
+            << loaded.size() * sizeof(int) / 1024 << "    " << endl;
+
+        MappedSortedArray::Options lazy;
+        start = high_resolution_clock::now();
+        MappedSortedArray mapped(binPath, lazy);
+        end = high_resolution_clock::now();
+        cout << "  mmap (): " << duration_cast<microseconds>(end - start).count() << " " << endl;
+
+        MappedSortedArray::Options eager;
+        eager.prefault = true;
+        eager.verifyData = true;
+        start = high_resolution_clock::now();
+        MappedSortedArray prefaulted(binPath, eager);
+        end = high_resolution_clock::now();
+        cout << "  mmap (prefault +  ): " << duration_cast<microseconds>(end - start).count() << " " << endl;
+
+        // :       
+        const int queryCount = 1000000;
+        vector<int> queries(queryCount);
+        for (int& q : queries) q = dis(gen);
+
+        long long foundVector = 0;
+        start = high_resolution_clock::now();
+        for (int q : queries) {
+            foundVector += BinarySearchAlgorithms::binarySearchIterative(loaded, q) != -1;
+        }
+        end = high_resolution_clock::now();
+        double vectorNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+        long long foundMapped = 0;
+        start = high_resolution_clock::now();
+        for (int q : queries) {
+            foundMapped += prefaulted.contains(q);
+        }
+        end = high_resolution_clock::now();
+        double mappedNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queryCount);
+
+        cout << "  binarySearchIterative (vector): " << vectorNs << " /,  " << foundVector << endl;
+        cout << "  MappedSortedArray::contains:    " << mappedNs << " /,  " << foundMapped << endl;
+        cout << "   : " << (equal(loaded.begin(), loaded.end(), prefaulted.data().begin(), prefaulted.data().end()) ? "" : "") << endl;
+
+        remove(csvPath.c_str());
+        remove(binPath.c_str());
+    }
+};
\ No newline at end of file
@@ -0,0 +1,529 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <xmmintrin.h>
+#define PREFETCH_READ(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#define PREFETCH_READ(address) ((void)0)
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+//
+//   " "  " ".   
+//  - ,       
+//   .     .
+
+class FilterHash {
+public:
+    //  MurmurHash3 -   64 
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    static uint64_t hash(int key, uint64_t seed) {
+        return mix(static_cast<uint64_t>(static_cast<uint32_t>(key)) + seed);
+    }
+
+    //  32-   [0, n)  
+    static uint32_t reduce(uint32_t value, uint32_t n) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(value) * n) >> 32);
+    }
+};
+
+// ====================    ====================
+
+//  k         - (512 ),
+//    -     
+class BlockedBloomFilter {
+private:
+    static constexpr uint32_t MAGIC = 0x4D4F4C42;  // "BLOM"
+    static const int WORDS_PER_BLOCK = 8;      // 8 * 64 = 512 
+
+    struct alignas(64) Block {
+        uint64_t words[WORDS_PER_BLOCK];
+    };
+
+    vector<Block> blocks;
+    uint32_t hashCount = 0;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t keyCount = 0;
+
+    uint32_t blockIndex(uint64_t h) const {
+        return FilterHash::reduce(static_cast<uint32_t>(h >> 32), static_cast<uint32_t>(blocks.size()));
+    }
+
+    //     9    :  
+    //   512    
+    template<typename Visitor>
+    bool forEachBit(uint64_t h, Visitor visit) const {
+        uint64_t bits = h & 0xFFFFFFFFULL;  //  32    
+        int available = 32;
+        for (uint32_t i = 0; i < hashCount; i++) {
+            if (available < 9) {
+                h = FilterHash::mix(h + i);
+                bits = h;
+                available = 64;
+            }
+            if (!visit(static_cast<uint32_t>(bits & 511))) return false;
+            bits >>= 9;
+            available -= 9;
+        }
+        return true;
+    }
+
+    bool testBlock(const Block& block, uint64_t h) const {
+        return forEachBit(h, [&block](uint32_t bit) {
+            return (block.words[bit >> 6] & (1ULL << (bit & 63))) != 0;
+            });
+    }
+
+    //    :    
+    //      512 / bitsPerKey
+    static double estimateFalsePositiveRate(double bitsPerKey, uint32_t k) {
+        double lambda = 512.0 / bitsPerKey;
+        double probability = exp(-lambda);  // P(  0 )
+        double rate = 0.0;
+        for (int keys = 0; keys < lambda * 4 + 64; keys++) {
+            if (keys > 0) probability *= lambda / keys;
+            double bitSet = 1.0 - pow(1.0 - 1.0 / 512, static_cast<double>(k) * keys);
+            rate += probability * pow(bitSet, k);
+        }
+        return rate;
+    }
+
+    static uint32_t bestHashCount(double bitsPerKey) {
+        uint32_t best = 1;
+        for (uint32_t k = 2; k <= 16; k++) {
+            if (estimateFalsePositiveRate(bitsPerKey, k) < estimateFalsePositiveRate(bitsPerKey, best)) best = k;
+        }
+        return best;
+    }
+
+public:
+    BlockedBloomFilter() = default;
+
+    //       
+    BlockedBloomFilter(span<const int> keys, double falsePositiveRate) {
+        build(keys, falsePositiveRate);
+    }
+
+    void build(span<const int> keys, double falsePositiveRate) {
+        if (falsePositiveRate <= 0.0 || falsePositiveRate >= 1.0) {
+            throw invalid_argument("      (0, 1)");
+        }
+
+        //     m/n = -ln p / ln^2 2   ,
+        //           p
+        double bitsPerKey = -log(falsePositiveRate) / (log(2.0) * log(2.0));
+        while (true) {
+            hashCount = bestHashCount(bitsPerKey);
+            if (estimateFalsePositiveRate(bitsPerKey, hashCount) <= falsePositiveRate || bitsPerKey > 64) break;
+            bitsPerKey += 0.25;
+        }
+
+        uint64_t totalBits = static_cast<uint64_t>(ceil(max<size_t>(keys.size(), 1) * bitsPerKey));
+        blocks.assign(max<uint64_t>(1, (totalBits + 511) / 512), Block{});
+        keyCount = keys.size();
+
+        for (int key : keys) {
+            uint64_t h = FilterHash::hash(key, seed);
+            Block& block = blocks[blockIndex(h)];
+            forEachBit(h, [&block](uint32_t bit) {
+                block.words[bit >> 6] |= 1ULL << (bit & 63);
+                return true;
+                });
+        }
+    }
+
+    bool mayContain(int key) const {
+        if (blocks.empty()) return false;
+        uint64_t h = FilterHash::hash(key, seed);
+        return testBlock(blocks[blockIndex(h)], h);
+    }
+
+    //  :       ,
+    //   -     
+    void mayContainBatch(span<const int> keys, uint8_t* out) const {
+        const size_t BATCH = 16;
+        uint64_t hashes[BATCH];
+
+        for (size_t start = 0; start < keys.size(); start += BATCH) {
+            size_t count = min(BATCH, keys.size() - start);
+            for (size_t i = 0; i < count; i++) {
+                hashes[i] = FilterHash::hash(keys[start + i], seed);
+                PREFETCH_READ(&blocks[blockIndex(hashes[i])]);
+            }
+            for (size_t i = 0; i < count; i++) {
+                out[start + i] = !blocks.empty() && testBlock(blocks[blockIndex(hashes[i])], hashes[i]);
+            }
+        }
+    }
+
+    size_t memoryBytes() const { return blocks.size() * sizeof(Block); }
+    double bitsPerKey() const { return keyCount == 0 ? 0.0 : memoryBytes() * 8.0 / keyCount; }
+    uint32_t getHashCount() const { return hashCount; }
+
+    // ====================  ====================
+
+    void save(ostream& out) const {
+        uint64_t blockCount = blocks.size();
+        out.write(reinterpret_cast<const char*>(&MAGIC), sizeof(MAGIC));
+        out.write(reinterpret_cast<const char*>(&hashCount), sizeof(hashCount));
+        out.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+        out.write(reinterpret_cast<const char*>(&keyCount), sizeof(keyCount));
+        out.write(reinterpret_cast<const char*>(&blockCount), sizeof(blockCount));
+        out.write(reinterpret_cast<const char*>(blocks.data()), blockCount * sizeof(Block));
+    }
+
+    static BlockedBloomFilter load(istream& in) {
+        BlockedBloomFilter filter;
+        uint32_t magic = 0;
+        uint64_t blockCount = 0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        if (magic != MAGIC) {
+            throw runtime_error("   ");
+        }
+        in.read(reinterpret_cast<char*>(&filter.hashCount), sizeof(filter.hashCount));
+        in.read(reinterpret_cast<char*>(&filter.seed), sizeof(filter.seed));
+        in.read(reinterpret_cast<char*>(&filter.keyCount), sizeof(filter.keyCount));
+        in.read(reinterpret_cast<char*>(&blockCount), sizeof(blockCount));
+        filter.blocks.resize(blockCount);
+        in.read(reinterpret_cast<char*>(filter.blocks.data()), blockCount * sizeof(Block));
+        if (!in) {
+            throw runtime_error("   ");
+        }
+        return filter;
+    }
+};
+
+// ==================== XOR- ====================
+
+// Xor- (Graf, Lemire):     3 ,
+// XOR     .  1.23 * w   
+//    2^-w;   (  ).
+// Fingerprint = uint8_t (~0.4%)  uint16_t (~0.0015%).
+template<typename Fingerprint>
+class XorFilter {
+private:
+    static constexpr uint32_t MAGIC = 0x46524F58;  // "XORF"
+
+    vector<Fingerprint> fingerprints;
+    uint32_t blockLength = 0;
+    uint64_t seed = 0;
+    uint64_t keyCount = 0;
+
+    static Fingerprint fingerprint(uint64_t h) {
+        return static_cast<Fingerprint>(h ^ (h >> 32));
+    }
+
+    static uint64_t rotl(uint64_t x, int r) {
+        return r == 0 ? x : (x << r) | (x >> (64 - r));
+    }
+
+    uint32_t slot(uint64_t h, int index) const {
+        uint32_t r = static_cast<uint32_t>(rotl(h, index * 21));
+        return FilterHash::reduce(r, blockLength) + index * blockLength;
+    }
+
+public:
+    XorFilter() = default;
+
+    explicit XorFilter(span<const int> keys) {
+        build(keys);
+    }
+
+    void build(span<const int> keysIn) {
+        //    ""  -  
+        vector<int> keys(keysIn.begin(), keysIn.end());
+        sort(keys.begin(), keys.end());
+        keys.erase(unique(keys.begin(), keys.end()), keys.end());
+        keyCount = keys.size();
+
+        uint32_t capacity = static_cast<uint32_t>(32 + 1.23 * keys.size());
+        blockLength = capacity / 3 + 1;
+        capacity = blockLength * 3;
+
+        vector<uint64_t> xorMask(capacity);
+        vector<uint32_t> counts(capacity);
+        vector<uint32_t> queue;
+        vector<pair<uint64_t, uint32_t>> stack;  // ( , ,    )
+        queue.reserve(capacity);
+        stack.reserve(keys.size());
+
+        mt19937_64 seedGen(0x5EED);
+        for (int attempt = 0; ; attempt++) {
+            if (attempt > 100) {
+                throw runtime_error("   xor-");
+            }
+            seed = seedGen();
+            fill(xorMask.begin(), xorMask.end(), 0);
+            fill(counts.begin(), counts.end(), 0);
+            queue.clear();
+            stack.clear();
+
+            for (int key : keys) {
+                uint64_t h = FilterHash::hash(key, seed);
+                for (int i = 0; i < 3; i++) {
+                    uint32_t s = slot(h, i);
+                    xorMask[s] ^= h;
+                    counts[s]++;
+                }
+            }
+
+            // :        
+            for (uint32_t s = 0; s < capacity; s++) {
+                if (counts[s] == 1) queue.push_back(s);
+            }
+            while (!queue.empty()) {
+                uint32_t s = queue.back();
+                queue.pop_back();
+                if (counts[s] != 1) continue;
+
+                uint64_t h = xorMask[s];
+                stack.push_back({ h, s });
+                for (int i = 0; i < 3; i++) {
+                    uint32_t other = slot(h, i);
+                    xorMask[other] ^= h;
+                    if (--counts[other] == 1) queue.push_back(other);
+                }
+            }
+
+            if (stack.size() == keys.size()) break;
+        }
+
+        //      
+        fingerprints.assign(capacity, 0);
+        for (size_t i = stack.size(); i-- > 0;) {
+            auto [h, s] = stack[i];
+            Fingerprint value = fingerprint(h);
+            for (int j = 0; j < 3; j++) {
+                uint32_t other = slot(h, j);
+                if (other != s) value ^= fingerprints[other];
+            }
+            fingerprints[s] = value;
+        }
+    }
+
+    bool mayContain(int key) const {
+        if (fingerprints.empty()) return false;
+        uint64_t h = FilterHash::hash(key, seed);
+        return fingerprint(h) == static_cast<Fingerprint>(
+            fingerprints[slot(h, 0)] ^ fingerprints[slot(h, 1)] ^ fingerprints[slot(h, 2)]);
+    }
+
+    void mayContainBatch(span<const int> keys, uint8_t* out) const {
+        const size_t BATCH = 16;
+        uint64_t hashes[BATCH];
+
+        for (size_t start = 0; start < keys.size(); start += BATCH) {
+            size_t count = min(BATCH, keys.size() - start);
+            for (size_t i = 0; i < count; i++) {
+                hashes[i] = FilterHash::hash(keys[start + i], seed);
+                if (!fingerprints.empty()) {
+                    for (int j = 0; j < 3; j++) PREFETCH_READ(&fingerprints[slot(hashes[i], j)]);
+                }
+            }
+            for (size_t i = 0; i < count; i++) {
+                uint64_t h = hashes[i];
+                out[start + i] = !fingerprints.empty() && fingerprint(h) == static_cast<Fingerprint>(
+                    fingerprints[slot(h, 0)] ^ fingerprints[slot(h, 1)] ^ fingerprints[slot(h, 2)]);
+            }
+        }
+    }
+
+    size_t memoryBytes() const { return fingerprints.size() * sizeof(Fingerprint); }
+    double bitsPerKey() const { return keyCount == 0 ? 0.0 : memoryBytes() * 8.0 / keyCount; }
+
+    void save(ostream& out) const {
+        uint32_t width = sizeof(Fingerprint);
+        uint64_t size = fingerprints.size();
+        out.write(reinterpret_cast<const char*>(&MAGIC), sizeof(MAGIC));
+        out.write(reinterpret_cast<const char*>(&width), sizeof(width));
+        out.write(reinterpret_cast<const char*>(&blockLength), sizeof(blockLength));
+        out.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+        out.write(reinterpret_cast<const char*>(&keyCount), sizeof(keyCount));
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(reinterpret_cast<const char*>(fingerprints.data()), size * sizeof(Fingerprint));
+    }
+
+    static XorFilter load(istream& in) {
+        XorFilter filter;
+        uint32_t magic = 0, width = 0;
+        uint64_t size = 0;
+        in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        in.read(reinterpret_cast<char*>(&width), sizeof(width));
+        if (magic != MAGIC || width != sizeof(Fingerprint)) {
+            throw runtime_error("    xor-");
+        }
+        in.read(reinterpret_cast<char*>(&filter.blockLength), sizeof(filter.blockLength));
+        in.read(reinterpret_cast<char*>(&filter.seed), sizeof(filter.seed));
+        in.read(reinterpret_cast<char*>(&filter.keyCount), sizeof(filter.keyCount));
+        in.read(reinterpret_cast<char*>(&size), sizeof(size));
+        filter.fingerprints.resize(size);
+        in.read(reinterpret_cast<char*>(filter.fingerprints.data()), size * sizeof(Fingerprint));
+        if (!in || size != static_cast<uint64_t>(filter.blockLength) * 3) {
+            throw runtime_error(" xor- ");
+        }
+        return filter;
+    }
+};
+
+// ====================    ====================
+
+//   :   ,  
+//  BinarySearchAlgorithms ( )  SearchAlgorithms ()
+template<typename Filter>
+class FilteredArray {
+private:
+    const vector<int>& arr;
+    bool sorted;
+    Filter filter;
+
+public:
+    FilteredArray(const vector<int>& data, bool isSorted, Filter builtFilter)
+        : arr(data), sorted(isSorted), filter(move(builtFilter)) {}
+
+    //    -1
+    int find(int target) const {
+        if (!filter.mayContain(target)) return -1;
+        return sorted ? BinarySearchAlgorithms::binarySearchIterative(arr, target)
+            : SearchAlgorithms::linearSearch(arr, target);
+    }
+
+    void findBatch(span<const int> targets, int* out) const {
+        vector<uint8_t> maybe(targets.size());
+        filter.mayContainBatch(targets, maybe.data());
+        for (size_t i = 0; i < targets.size(); i++) {
+            out[i] = !maybe[i] ? -1 : (sorted ? BinarySearchAlgorithms::binarySearchIterative(arr, targets[i])
+                : SearchAlgorithms::linearSearch(arr, targets[i]));
+        }
+    }
+
+    const Filter& getFilter() const { return filter; }
+
+    //     : <  >.filter
+    void saveFilter(const string& arrayPath) const {
+        ofstream out(arrayPath + ".filter", ios::binary | ios::trunc);
+        if (!out) {
+            throw runtime_error("      " + arrayPath);
+        }
+        filter.save(out);
+    }
+
+    static Filter loadFilter(const string& arrayPath) {
+        ifstream in(arrayPath + ".filter", ios::binary);
+        if (!in) {
+            throw runtime_error("     " + arrayPath);
+        }
+        return Filter::load(in);
+    }
+};
+
+// ====================  ====================
+
+class FilterBenchmark {
+private:
+    template<typename Filter>
+    static void reportFilter(const string& name, const Filter& filter, const vector<int>& missing) {
+        auto start = high_resolution_clock::now();
+        long long positives = 0;
+        for (int key : missing) positives += filter.mayContain(key);
+        auto end = high_resolution_clock::now();
+        double singleNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(missing.size());
+
+        vector<uint8_t> results(missing.size());
+        start = high_resolution_clock::now();
+        filter.mayContainBatch(missing, results.data());
+        end = high_resolution_clock::now();
+        double batchNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(missing.size());
+
+        cout << "  " << name << ": " << filter.bitsPerKey() << " /,   "
+            << 100.0 * positives / missing.size() << "%, " << singleNs << " /,  "
+            << batchNs << " /" << endl;
+    }
+
+public:
+    static void compareFilters(int size = 10000000) {
+        cout << "\n===     (n = " << size << ") ===" << endl;
+
+        mt19937 gen(13);
+        // ׸   ,  -  
+        vector<int> arr(size);
+        for (int i = 0; i < size; i++) arr[i] = 2 * i;
+
+        vector<int> missing(2000000);
+        uniform_int_distribution<int> dis(0, size - 1);
+        for (int& key : missing) key = 2 * dis(gen) + 1;
+
+        for (double rate : { 0.01, 0.001 }) {
+            BlockedBloomFilter bloom(arr, rate);
+            reportFilter("  (p=" + to_string(rate) + ", k=" + to_string(bloom.getHashCount()) + ")", bloom, missing);
+        }
+        XorFilter<uint8_t> xor8(arr);
+        reportFilter("Xor8", xor8, missing);
+        XorFilter<uint16_t> xor16(arr);
+        reportFilter("Xor16", xor16, missing);
+
+        // : 90% 
+        vector<int> queries(1000000);
+        for (size_t i = 0; i < queries.size(); i++) {
+            queries[i] = (i % 10 == 0) ? 2 * dis(gen) : 2 * dis(gen) + 1;
+        }
+
+        long long hits = 0;
+        auto start = high_resolution_clock::now();
+        for (int q : queries) hits += BinarySearchAlgorithms::binarySearchIterative(arr, q) != -1;
+        auto end = high_resolution_clock::now();
+        double plainNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queries.size());
+
+        FilteredArray<BlockedBloomFilter> filtered(arr, true, BlockedBloomFilter(arr, 0.01));
+        long long filteredHits = 0;
+        start = high_resolution_clock::now();
+        for (int q : queries) filteredHits += filtered.find(q) != -1;
+        end = high_resolution_clock::now();
+        double filteredNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queries.size());
+
+        vector<int> positions(queries.size());
+        start = high_resolution_clock::now();
+        filtered.findBatch(queries, positions.data());
+        end = high_resolution_clock::now();
+        double batchNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queries.size());
+
+        cout << "\n  90% , binarySearchIterative: " << plainNs << " / (" << hits << " )" << endl;
+        cout << "    :                    " << filteredNs << " / (" << filteredHits << " )" << endl;
+        cout << "    , :           " << batchNs << " /" << endl;
+
+        //        
+        string arrayPath = "filter_bench_array";
+        filtered.saveFilter(arrayPath);
+        BlockedBloomFilter restored = FilteredArray<BlockedBloomFilter>::loadFilter(arrayPath);
+        bool same = true;
+        for (int i = 0; i < 1000; i++) {
+            same = same && restored.mayContain(queries[i]) == filtered.getFilter().mayContain(queries[i]);
+        }
+        cout << "  : " << (same ? "OK" : "") << endl;
+        remove((arrayPath + ".filter").c_str());
+    }
+};
\ No newline at end of file
@@ -0,0 +1,344 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#ifndef PREFETCH_READ
+#ifdef HAS_SSE2
+#define PREFETCH_READ(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#define PREFETCH_READ(address) ((void)0)
+#endif
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ==================== -    ====================
+//
+//    Swiss table:
+//  -      16 ;
+//  -      : EMPTY  7   ;
+//  -    16    SSE2-,
+//          .
+//         ;
+//          next.
+
+class HashIndex {
+private:
+    static constexpr int GROUP_SIZE = 16;
+    static constexpr int8_t EMPTY = -128;  // 0x80:       
+
+    struct Slot {
+        int key;
+        int first;   //   
+        int last;    //    (    )
+        int count;   //  
+    };
+
+    vector<int8_t> control;   //  , capacity 
+    vector<Slot> slots;
+    vector<int> next;         // next[p] -        -1
+    size_t groupMask = 0;     //   -  
+    size_t distinctKeys = 0;
+
+    static uint64_t hashKey(int key) {
+        uint64_t x = static_cast<uint32_t>(key);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    static int8_t tagOf(uint64_t h) { return static_cast<int8_t>(h & 0x7F); }
+    size_t groupOf(uint64_t h) const { return (h >> 7) & groupMask; }
+    size_t capacity() const { return control.size(); }
+
+    //    ,      value
+    uint32_t matchMask(size_t group, int8_t value) const {
+        const int8_t* ctrl = control.data() + group * GROUP_SIZE;
+#ifdef HAS_SSE2
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value))));
+#else
+        uint32_t mask = 0;
+        for (int i = 0; i < GROUP_SIZE; i++) {
+            if (ctrl[i] == value) mask |= 1u << i;
+        }
+        return mask;
+#endif
+    }
+
+    //   ; -1,   
+    long long findSlot(int key, uint64_t h) const {
+        if (control.empty()) return -1;
+
+        int8_t tag = tagOf(h);
+        size_t group = groupOf(h);
+
+        //        
+        for (size_t step = 1; ; step++) {
+            uint32_t mask = matchMask(group, tag);
+            while (mask != 0) {
+                size_t index = group * GROUP_SIZE + countr_zero(mask);
+                if (slots[index].key == key) return static_cast<long long>(index);
+                mask &= mask - 1;
+            }
+
+            //      -    
+            if (matchMask(group, EMPTY) != 0) return -1;
+            group = (group + step) & groupMask;
+        }
+    }
+
+    //       (  )
+    size_t findEmptySlot(uint64_t h) const {
+        size_t group = groupOf(h);
+        for (size_t step = 1; ; step++) {
+            uint32_t empty = matchMask(group, EMPTY);
+            if (empty != 0) return group * GROUP_SIZE + countr_zero(empty);
+            group = (group + step) & groupMask;
+        }
+    }
+
+    void rehash(size_t newGroups) {
+        vector<int8_t> oldControl = move(control);
+        vector<Slot> oldSlots = move(slots);
+
+        control.assign(newGroups * GROUP_SIZE, EMPTY);
+        slots.assign(newGroups * GROUP_SIZE, Slot{});
+        groupMask = newGroups - 1;
+
+        for (size_t i = 0; i < oldControl.size(); i++) {
+            if (oldControl[i] == EMPTY) continue;
+            uint64_t h = hashKey(oldSlots[i].key);
+            size_t index = findEmptySlot(h);
+            control[index] = tagOf(h);
+            slots[index] = oldSlots[i];
+        }
+    }
+
+    //   7/8
+    void growIfNeeded() {
+        if (control.empty()) {
+            rehash(1);
+        }
+        else if ((distinctKeys + 1) * 8 > capacity() * 7) {
+            rehash((groupMask + 1) * 2);
+        }
+    }
+
+public:
+    HashIndex() = default;
+
+    //  :  i  arr[i]
+    explicit HashIndex(const vector<int>& arr) {
+        build(arr);
+    }
+
+    void build(const vector<int>& arr) {
+        control.clear();
+        slots.clear();
+        next.assign(arr.size(), -1);
+        distinctKeys = 0;
+        reserve(arr.size());
+
+        for (size_t i = 0; i < arr.size(); i++) {
+            insert(arr[i], static_cast<int>(i));
+        }
+    }
+
+    //    expectedKeys    
+    void reserve(size_t expectedKeys) {
+        size_t groups = 1;
+        while (groups * GROUP_SIZE * 7 < expectedKeys * 8) groups *= 2;
+        if (groups > groupMask + 1 || control.empty()) {
+            rehash(groups);
+        }
+    }
+
+    //    (,  arr.push_back(key))
+    void insert(int key, int position) {
+        if (position < 0) {
+            throw invalid_argument("    ");
+        }
+        if (static_cast<size_t>(position) >= next.size()) {
+            next.resize(max(next.size() * 2, static_cast<size_t>(position) + 1), -1);
+        }
+        next[position] = -1;
+
+        uint64_t h = hashKey(key);
+        long long found = findSlot(key, h);
+        if (found >= 0) {
+            Slot& slot = slots[found];
+            next[slot.last] = position;
+            slot.last = position;
+            slot.count++;
+            return;
+        }
+
+        growIfNeeded();
+        size_t index = findEmptySlot(h);
+        control[index] = tagOf(h);
+        slots[index] = { key, position, position, 1 };
+        distinctKeys++;
+    }
+
+    //     -1 ( SearchAlgorithms::linearSearch)
+    int find(int key) const {
+        long long index = findSlot(key, hashKey(key));
+        return index < 0 ? -1 : slots[index].first;
+    }
+
+    int count(int key) const {
+        long long index = findSlot(key, hashKey(key));
+        return index < 0 ? 0 : slots[index].count;
+    }
+
+    //      ( SearchAlgorithms::linearSearchAll)
+    vector<int> findAll(int key) const {
+        vector<int> positions;
+        long long index = findSlot(key, hashKey(key));
+        if (index < 0) return positions;
+
+        positions.reserve(slots[index].count);
+        for (int p = slots[index].first; p != -1; p = next[p]) {
+            positions.push_back(p);
+        }
+        return positions;
+    }
+
+    //  :      16  ,
+    //      
+    void findBatch(span<const int> keys, int* out) const {
+        const size_t BATCH = 16;
+        uint64_t hashes[BATCH];
+
+        for (size_t start = 0; start < keys.size(); start += BATCH) {
+            size_t n = min(BATCH, keys.size() - start);
+            for (size_t i = 0; i < n; i++) {
+                hashes[i] = hashKey(keys[start + i]);
+                if (!control.empty()) {
+                    size_t group = groupOf(hashes[i]);
+                    PREFETCH_READ(control.data() + group * GROUP_SIZE);
+                    PREFETCH_READ(slots.data() + group * GROUP_SIZE);
+                }
+            }
+            for (size_t i = 0; i < n; i++) {
+                long long index = findSlot(keys[start + i], hashes[i]);
+                out[start + i] = index < 0 ? -1 : slots[index].first;
+            }
+        }
+    }
+
+    size_t distinctCount() const { return distinctKeys; }
+    double loadFactor() const { return control.empty() ? 0.0 : static_cast<double>(distinctKeys) / capacity(); }
+
+    size_t memoryBytes() const {
+        return control.size() * sizeof(int8_t) + slots.size() * sizeof(Slot) + next.size() * sizeof(int);
+    }
+};
+
+// ====================       ====================
+
+class HashIndexBenchmark {
+private:
+    static double nsPerQuery(high_resolution_clock::time_point start, high_resolution_clock::time_point end, size_t queries) {
+        return duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queries);
+    }
+
+public:
+    static void compareWithSearch() {
+        cout << "\n=== - vs     ===" << endl;
+
+        mt19937 gen(17);
+        vector<int> sizes = { 10000, 1000000, 10000000 };
+
+        for (int size : sizes) {
+            //   :   2   
+            uniform_int_distribution<int> dis(0, size / 2);
+            vector<int> arr(size);
+            for (int& v : arr) v = dis(gen);
+
+            vector<int> queries(1000000);
+            for (int& q : queries) q = dis(gen);
+
+            cout << "\n--- n = " << size << " ---" << endl;
+
+            //   -    ,   
+            size_t linearQueries = max<size_t>(10, 100000000 / size);
+            linearQueries = min(linearQueries, queries.size());
+            long long linearSum = 0;
+            auto start = high_resolution_clock::now();
+            for (size_t i = 0; i < linearQueries; i++) {
+                linearSum += SearchAlgorithms::linearSearch(arr, queries[i]);
+            }
+            auto end = high_resolution_clock::now();
+            cout << "  linearSearch:              " << nsPerQuery(start, end, linearQueries) << " /" << endl;
+
+            //     
+            start = high_resolution_clock::now();
+            vector<int> sorted = arr;
+            sort(sorted.begin(), sorted.end());
+            end = high_resolution_clock::now();
+            cout << "   :          " << duration_cast<microseconds>(end - start).count() << " " << endl;
+
+            long long binaryFound = 0;
+            start = high_resolution_clock::now();
+            for (int q : queries) {
+                binaryFound += BinarySearchAlgorithms::binarySearchIterative(sorted, q) != -1;
+            }
+            end = high_resolution_clock::now();
+            cout << "  binarySearchIterative:     " << nsPerQuery(start, end, queries.size()) << " /" << endl;
+
+            start = high_resolution_clock::now();
+            HashIndex index(arr);
+            end = high_resolution_clock::now();
+            cout << "   HashIndex:      " << duration_cast<microseconds>(end - start).count() << "  ("
+                << index.memoryBytes() / 1024 << " ,  " << index.loadFactor() << ")" << endl;
+
+            long long hashFound = 0;
+            long long hashSum = 0;
+            start = high_resolution_clock::now();
+            for (size_t i = 0; i < queries.size(); i++) {
+                int pos = index.find(queries[i]);
+                hashFound += pos != -1;
+                if (i < linearQueries) hashSum += pos;
+            }
+            end = high_resolution_clock::now();
+            cout << "  HashIndex::find:           " << nsPerQuery(start, end, queries.size()) << " /" << endl;
+
+            vector<int> positions(queries.size());
+            start = high_resolution_clock::now();
+            index.findBatch(queries, positions.data());
+            end = high_resolution_clock::now();
+            cout << "  HashIndex::findBatch:      " << nsPerQuery(start, end, queries.size()) << " /" << endl;
+
+            // :     linearSearch,   -   
+            bool allMatch = true;
+            for (size_t i = 0; i < 100; i++) {
+                allMatch = allMatch && index.findAll(queries[i]) == SearchAlgorithms::linearSearchAll(arr, queries[i]);
+            }
+            cout << "  : " << ((hashSum == linearSum && hashFound == binaryFound && allMatch) ? "OK" : "") << endl;
+        }
+    }
+};
\ No newline at end of file
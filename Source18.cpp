@@ -0,0 +1,334 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <string>
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================     ====================
+//
+//      (   arr[i] >= target)
+//       ("")  probes.
+
+class AdaptiveSearchAlgorithms {
+public:
+    // ,      
+    static constexpr int LINEAR_THRESHOLD = 8;
+
+    //     - O(log n),    
+    static int binaryLowerBound(const vector<int>& arr, int target, long long& probes) {
+        return binaryLowerBound(arr, target, 0, static_cast<int>(arr.size()), probes);
+    }
+
+    static int binaryLowerBound(const vector<int>& arr, int target, int left, int right, long long& probes) {
+        while (left < right) {
+            int mid = left + (right - left) / 2;
+            probes++;
+            if (arr[mid] < target) {
+                left = mid + 1;
+            }
+            else {
+                right = mid;
+            }
+        }
+        return left;
+    }
+
+    //     (IBS):    
+    //   ;        ,
+    //    .    O(log log n),
+    //    - O(log n),     .
+    static int interpolationSearch(const vector<int>& arr, int target, long long& probes) {
+        int left = 0;
+        int right = static_cast<int>(arr.size());  //    [left, right]
+
+        while (right - left > LINEAR_THRESHOLD) {
+            int low = arr[left];
+            int high = arr[right - 1];
+            probes += 2;
+
+            if (target <= low) return left;
+            if (target > high) return right;
+
+            //    low  target; double  
+            double fraction = (static_cast<double>(target) - low) / (static_cast<double>(high) - low);
+            int pos = left + static_cast<int>(fraction * (right - 1 - left));
+            pos = clamp(pos, left, right - 1);
+
+            int before = right - left;
+            probes++;
+            if (arr[pos] < target) {
+                left = pos + 1;
+            }
+            else {
+                right = pos;
+            }
+
+            // :    -   
+            if ((right - left) * 2 > before && right - left > LINEAR_THRESHOLD) {
+                int mid = left + (right - left) / 2;
+                probes++;
+                if (arr[mid] < target) {
+                    left = mid + 1;
+                }
+                else {
+                    right = mid;
+                }
+            }
+        }
+
+        //    
+        while (left < right) {
+            probes++;
+            if (arr[left] >= target) break;
+            left++;
+        }
+        return left;
+    }
+
+    //  ()    - O(log d),
+    //  d -   hint  
+    static int exponentialSearch(const vector<int>& arr, int target, int hint, long long& probes) {
+        int n = static_cast<int>(arr.size());
+        if (n == 0) return 0;
+        hint = clamp(hint, 0, n - 1);
+
+        probes++;
+        if (arr[hint] < target) {
+            //  :   
+            int prev = hint;
+            int step = 1;
+            int curr = hint + 1;
+            while (curr < n) {
+                probes++;
+                if (arr[curr] >= target) break;
+                prev = curr;
+                step *= 2;
+                curr = hint + step;
+            }
+            return binaryLowerBound(arr, target, prev + 1, min(curr, n), probes);
+        }
+        else {
+            //   hint  :   
+            int prev = hint;
+            int step = 1;
+            int curr = hint - 1;
+            while (curr >= 0) {
+                probes++;
+                if (arr[curr] < target) break;
+                prev = curr;
+                step *= 2;
+                curr = hint - step;
+            }
+            return binaryLowerBound(arr, target, max(curr + 1, 0), prev, probes);
+        }
+    }
+};
+
+// ====================    ====================
+
+class AdaptiveSortedIndex {
+public:
+    enum class Strategy { Binary, Interpolation };
+
+private:
+    const vector<int>& arr;
+    Strategy strategy = Strategy::Binary;
+    double interpolationError = 0.0;   //       n
+    mutable long long probes = 0;
+    mutable long long queries = 0;
+
+    // :    (min, 0) - (max, n) 
+    //   .   =   .
+    void profile() {
+        int n = static_cast<int>(arr.size());
+        if (n < 64 || arr.back() == arr.front()) {
+            strategy = Strategy::Binary;
+            return;
+        }
+
+        const int samples = 256;
+        double low = arr.front();
+        double high = arr.back();
+        double totalError = 0.0;
+        for (int s = 0; s < samples; s++) {
+            int index = static_cast<int>(static_cast<long long>(s) * (n - 1) / (samples - 1));
+            double predicted = (arr[index] - low) / (high - low) * (n - 1);
+            totalError += fabs(predicted - index);
+        }
+        interpolationError = totalError / samples / n;
+
+        //  ,       
+        //   sqrt(n):     O(log log n) 
+        strategy = (interpolationError * n < sqrt(static_cast<double>(n))) ? Strategy::Interpolation : Strategy::Binary;
+    }
+
+public:
+    explicit AdaptiveSortedIndex(const vector<int>& sorted) : arr(sorted) {
+        profile();
+    }
+
+    //    ( )
+    AdaptiveSortedIndex(const vector<int>& sorted, Strategy forced) : arr(sorted), strategy(forced) {}
+
+    Strategy getStrategy() const { return strategy; }
+    double getInterpolationError() const { return interpolationError; }
+
+    string strategyName() const {
+        return strategy == Strategy::Interpolation ? "" : "";
+    }
+
+    int lowerBound(int target) const {
+        queries++;
+        return strategy == Strategy::Interpolation
+            ? AdaptiveSearchAlgorithms::interpolationSearch(arr, target, probes)
+            : AdaptiveSearchAlgorithms::binaryLowerBound(arr, target, probes);
+    }
+
+    //   :    hint
+    int lowerBound(int target, int hint) const {
+        queries++;
+        return AdaptiveSearchAlgorithms::exponentialSearch(arr, target, hint, probes);
+    }
+
+    //     -1 ( BinarySearchAlgorithms::binarySearchFirstOccurrence)
+    int find(int target) const {
+        int pos = lowerBound(target);
+        return (pos < static_cast<int>(arr.size()) && arr[pos] == target) ? pos : -1;
+    }
+
+    //     :   
+    //    
+    class Cursor {
+    private:
+        const AdaptiveSortedIndex& index;
+        int position = -1;
+
+    public:
+        explicit Cursor(const AdaptiveSortedIndex& idx) : index(idx) {}
+
+        int lowerBound(int target) {
+            position = (position < 0) ? index.lowerBound(target) : index.lowerBound(target, position);
+            return position;
+        }
+
+        int find(int target) {
+            int pos = lowerBound(target);
+            return (pos < static_cast<int>(index.arr.size()) && index.arr[pos] == target) ? pos : -1;
+        }
+    };
+
+    Cursor cursor() const { return Cursor(*this); }
+
+    double probesPerQuery() const { return queries == 0 ? 0.0 : static_cast<double>(probes) / queries; }
+
+    void resetStats() const {
+        probes = 0;
+        queries = 0;
+    }
+};
+
+// ====================   ====================
+
+class AdaptiveSearchBenchmark {
+private:
+    template<typename Func>
+    static double nsPerQuery(Func func, const vector<int>& queries) {
+        auto start = high_resolution_clock::now();
+        long long sink = 0;
+        for (int q : queries) sink += func(q);
+        auto end = high_resolution_clock::now();
+        volatile long long guard = sink;  //     
+        (void)guard;
+        return duration_cast<nanoseconds>(end - start).count() / static_cast<double>(queries.size());
+    }
+
+    static void runDataset(const string& name, const vector<int>& arr, mt19937& gen) {
+        cout << "\n--- " << name << " (n = " << arr.size() << ") ---" << endl;
+
+        uniform_int_distribution<int> pick(0, static_cast<int>(arr.size()) - 1);
+        vector<int> queries(1000000);
+        for (int& q : queries) q = arr[pick(gen)];
+
+        //  :   (   )
+        vector<int> stream = queries;
+        sort(stream.begin(), stream.end());
+
+        AdaptiveSortedIndex binary(arr, AdaptiveSortedIndex::Strategy::Binary);
+        AdaptiveSortedIndex interpolation(arr, AdaptiveSortedIndex::Strategy::Interpolation);
+        AdaptiveSortedIndex selected(arr);
+
+        double tPlain = nsPerQuery([&](int q) { return BinarySearchAlgorithms::binarySearchIterative(arr, q); }, queries);
+        double tBinary = nsPerQuery([&](int q) { return binary.lowerBound(q); }, queries);
+        double tInterp = nsPerQuery([&](int q) { return interpolation.lowerBound(q); }, queries);
+        double tSelected = nsPerQuery([&](int q) { return selected.lowerBound(q); }, queries);
+
+        cout << "  : " << selected.strategyName() << " (  "
+            << selected.getInterpolationError() * 100 << "% n)" << endl;
+        cout << "  binarySearchIterative:       " << tPlain << " /" << endl;
+        cout << "   ( ):   " << tBinary << " /, " << binary.probesPerQuery() << " /" << endl;
+        cout << "   (IBS):      " << tInterp << " /, " << interpolation.probesPerQuery() << " /" << endl;
+        cout << "  :                   " << tSelected << " /, " << selected.probesPerQuery() << " /" << endl;
+
+        //  :     
+        selected.resetStats();
+        double tStreamPlain = nsPerQuery([&](int q) { return selected.lowerBound(q); }, stream);
+        double streamPlainProbes = selected.probesPerQuery();
+
+        selected.resetStats();
+        AdaptiveSortedIndex::Cursor cursor = selected.cursor();
+        bool correct = true;
+        double tStreamHinted = nsPerQuery([&](int q) {
+            int pos = cursor.lowerBound(q);
+            correct = correct && arr[pos] == q && (pos == 0 || arr[pos - 1] < q);
+            return pos;
+            }, stream);
+
+        cout << "     : " << tStreamPlain << " /, " << streamPlainProbes << " /" << endl;
+        cout << "     :    " << tStreamHinted << " /, " << selected.probesPerQuery()
+            << " / (" << (correct ? "OK" : "") << ")" << endl;
+    }
+
+public:
+    static void compareStrategies() {
+        cout << "\n=== ,     ===" << endl;
+
+        mt19937 gen(31);
+        const int n = 10000000;
+
+        //   :   100    
+        vector<int> timestamps(n);
+        uniform_int_distribution<int> jitter(90, 110);
+        int t = 0;
+        for (int& v : timestamps) {
+            t += jitter(gen);
+            v = t;
+        }
+        runDataset("  ", timestamps, gen);
+
+        //   :  
+        vector<int> skewed(n);
+        for (int i = 0; i < n; i++) {
+            skewed[i] = static_cast<int>(static_cast<long long>(i) * i / 50000);
+        }
+        runDataset(" ", skewed, gen);
+
+        // :  ,    
+        vector<int> clustered(n);
+        uniform_int_distribution<int> small(0, 3);
+        int value = 0;
+        for (int i = 0; i < n; i++) {
+            value += (i % 100000 == 0) ? 10000000 : small(gen);
+            clustered[i] = value;
+        }
+        runDataset("", clustered, gen);
+    }
+};
\ No newline at end of file
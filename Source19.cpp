@@ -0,0 +1,354 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <cstdint>
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+//
+//         
+// .          :
+//  -    (Bentley-Sedgewick): 
+//         d,      d + 1;
+//  - MSD radix sort:   256     d;
+//          , 
+//           .
+//  "  "  0     .
+
+class StringSort {
+public:
+    static constexpr size_t INSERTION_THRESHOLD = 16;   //  -  
+    static constexpr size_t RADIX_THRESHOLD = 4096;     //  -   
+
+private:
+    //   argsort:    
+    struct IndexedKey {
+        string_view key;
+        uint32_t index;
+    };
+
+    static string_view keyOf(const string_view& s) { return s; }
+    static string_view keyOf(const IndexedKey& item) { return item.key; }
+
+    //    depth: 1..256   , 0 -  
+    template<typename T>
+    static int charAt(const T& item, size_t depth) {
+        string_view s = keyOf(item);
+        return depth < s.size() ? static_cast<unsigned char>(s[depth]) + 1 : 0;
+    }
+
+    //         depth
+    template<typename T>
+    static void insertionSort(T* a, size_t n, size_t depth) {
+        for (size_t i = 1; i < n; i++) {
+            T item = a[i];
+            string_view key = keyOf(item);
+            string_view suffix = key.substr(min(depth, key.size()));
+            size_t j = i;
+            while (j > 0) {
+                string_view other = keyOf(a[j - 1]);
+                if (other.substr(min(depth, other.size())) <= suffix) break;
+                a[j] = a[j - 1];
+                j--;
+            }
+            a[j] = item;
+        }
+    }
+
+    //       (,   depth  ).
+    //          .
+    template<typename T>
+    static size_t commonPrefixLength(const T* a, size_t n, size_t depth) {
+        string_view first = keyOf(a[0]);
+        size_t length = first.size();
+        for (size_t i = 1; i < n && length > depth; i++) {
+            string_view other = keyOf(a[i]);
+            size_t limit = min(length, other.size());
+            size_t k = depth;
+            while (k < limit && first[k] == other[k]) k++;
+            length = k;
+        }
+        return max(length, depth);
+    }
+
+    static int medianOfThree(int x, int y, int z) {
+        if (x < y) {
+            if (y < z) return y;
+            return x < z ? z : x;
+        }
+        if (x < z) return x;
+        return y < z ? z : y;
+    }
+
+    template<typename T>
+    static void multikeyQuicksort(T* a, size_t n, size_t depth) {
+        //       
+        while (n > INSERTION_THRESHOLD) {
+            int pivot = medianOfThree(charAt(a[0], depth), charAt(a[n / 2], depth), charAt(a[n - 1], depth));
+
+            //  : [0, lt) < pivot, [lt, gt) == pivot, [gt, n) > pivot
+            size_t lt = 0, i = 0, gt = n;
+            while (i < gt) {
+                int c = charAt(a[i], depth);
+                if (c < pivot) {
+                    swap(a[lt++], a[i++]);
+                }
+                else if (c > pivot) {
+                    swap(a[i], a[--gt]);
+                }
+                else {
+                    i++;
+                }
+            }
+
+            if (lt == 0 && gt == n) {
+                //      -    
+                if (pivot == 0) return;
+                depth = commonPrefixLength(a, n, depth + 1);
+                continue;
+            }
+
+            multikeyQuicksort(a, lt, depth);
+            if (pivot != 0) {
+                //        
+                multikeyQuicksort(a + lt, gt - lt, depth + 1);
+            }
+            a += gt;
+            n -= gt;
+        }
+        insertionSort(a, n, depth);
+    }
+
+    template<typename T>
+    static void msdRadixSort(T* a, size_t n, size_t depth, T* buffer, uint16_t* cache) {
+        while (true) {
+            if (n < RADIX_THRESHOLD) {
+                multikeyQuicksort(a, n, depth);
+                return;
+            }
+
+            //    :   
+            size_t count[257] = {};
+            for (size_t i = 0; i < n; i++) {
+                cache[i] = static_cast<uint16_t>(charAt(a[i], depth));
+                count[cache[i]]++;
+            }
+
+            //      (  ) -   
+            int single = cache[0];
+            if (count[single] == n) {
+                if (single == 0) return;  //    -  
+                depth = commonPrefixLength(a, n, depth + 1);
+                continue;
+            }
+
+            size_t start[257];
+            size_t offset = 0;
+            for (int c = 0; c < 257; c++) {
+                start[c] = offset;
+                offset += count[c];
+            }
+
+            size_t position[257];
+            copy(start, start + 257, position);
+            for (size_t i = 0; i < n; i++) {
+                buffer[position[cache[i]]++] = a[i];
+            }
+            copy(buffer, buffer + n, a);
+
+            //  0 - ,    ,    
+            for (int c = 1; c < 257; c++) {
+                if (count[c] > 1) {
+                    msdRadixSort(a + start[c], count[c], depth + 1, buffer, cache);
+                }
+            }
+            return;
+        }
+    }
+
+    template<typename T>
+    static void msdRadixSort(T* a, size_t n) {
+        vector<T> buffer(n);
+        vector<uint16_t> cache(n);
+        msdRadixSort(a, n, 0, buffer.data(), cache.data());
+    }
+
+public:
+    // ====================   ====================
+
+    static void multikeyQuicksort(span<string_view> views) {
+        multikeyQuicksort(views.data(), views.size(), 0);
+    }
+
+    static void msdRadixSort(span<string_view> views) {
+        msdRadixSort(views.data(), views.size());
+    }
+
+    //    (   )
+    static void sort(vector<string_view>& views) {
+        msdRadixSort(views.data(), views.size());
+    }
+
+    //  :  ,    
+    static void sort(vector<string>& strings) {
+        vector<uint32_t> order = argsort(strings);
+        vector<string> sorted(strings.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            sorted[i] = move(strings[order[i]]);
+        }
+        strings.swap(sorted);
+    }
+
+    // ,   (  )
+    static vector<uint32_t> argsort(span<const string_view> keys) {
+        vector<IndexedKey> items(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            items[i] = { keys[i], static_cast<uint32_t>(i) };
+        }
+        msdRadixSort(items.data(), items.size());
+
+        vector<uint32_t> order(items.size());
+        for (size_t i = 0; i < items.size(); i++) {
+            order[i] = items[i].index;
+        }
+        return order;
+    }
+
+    static vector<uint32_t> argsort(const vector<string>& strings) {
+        vector<string_view> views(strings.begin(), strings.end());
+        return argsort(span<const string_view>(views));
+    }
+
+    //     , :
+    //   StringSort::sortByKey(people, [](const Person& p) { return string_view(p.name); });
+    template<typename Record, typename KeyFunc>
+    static void sortByKey(vector<Record>& records, KeyFunc key) {
+        vector<string_view> keys(records.size());
+        for (size_t i = 0; i < records.size(); i++) {
+            keys[i] = key(records[i]);
+        }
+        vector<uint32_t> order = argsort(span<const string_view>(keys));
+
+        vector<Record> sorted;
+        sorted.reserve(records.size());
+        for (uint32_t index : order) {
+            sorted.push_back(move(records[index]));
+        }
+        records.swap(sorted);
+    }
+};
+
+// ====================   std::sort ====================
+
+class StringSortBenchmark {
+private:
+    static vector<string> generateNames(size_t count, mt19937& gen) {
+        vector<string> first = { "", "", "", "", "", "", "", "", "", "" };
+        vector<string> last = { "", "", "", "", "", "", "", "", "", "" };
+        uniform_int_distribution<size_t> f(0, first.size() - 1), l(0, last.size() - 1);
+        uniform_int_distribution<int> suffix(0, 99999);
+
+        vector<string> names(count);
+        for (string& name : names) {
+            name = last[l(gen)] + " " + first[f(gen)] + " " + to_string(suffix(gen));
+        }
+        return names;
+    }
+
+    static vector<string> generateUrls(size_t count, mt19937& gen) {
+        vector<string> hosts = { "https://www.example.com", "https://shop.example.com", "https://api.example.org", "http://cdn.example.net" };
+        vector<string> sections = { "/catalog/", "/catalog/item/", "/users/", "/static/img/", "/search?q=" };
+        uniform_int_distribution<size_t> h(0, hosts.size() - 1), s(0, sections.size() - 1);
+        uniform_int_distribution<int> id(0, 9999999);
+
+        vector<string> urls(count);
+        for (string& url : urls) {
+            url = hosts[h(gen)] + sections[s(gen)] + to_string(id(gen));
+        }
+        return urls;
+    }
+
+    //      -     
+    static vector<string> generateSharedPrefix(size_t count, mt19937& gen) {
+        string prefix = "/var/log/services/payments/production/eu-central/2026/10/19/host-0001/shard-";
+        uniform_int_distribution<int> id(0, 99999999);
+
+        vector<string> keys(count);
+        for (string& key : keys) {
+            key = prefix + to_string(id(gen));
+        }
+        return keys;
+    }
+
+    template<typename Func>
+    static long long measureMs(Func func) {
+        auto start = high_resolution_clock::now();
+        func();
+        auto end = high_resolution_clock::now();
+        return duration_cast<milliseconds>(end - start).count();
+    }
+
+    static void runDataset(const string& name, const vector<string>& data) {
+        cout << "\n--- " << name << " (" << data.size() << " ) ---" << endl;
+
+        vector<string> expected = data;
+        long long tStd = measureMs([&]() { std::sort(expected.begin(), expected.end()); });
+
+        vector<string> strings = data;
+        long long tEngine = measureMs([&]() { StringSort::sort(strings); });
+
+        vector<string_view> views(data.begin(), data.end());
+        long long tStdViews = measureMs([&]() { std::sort(views.begin(), views.end()); });
+
+        views.assign(data.begin(), data.end());
+        long long tMkqs = measureMs([&]() { StringSort::multikeyQuicksort(views); });
+        bool mkqsOk = equal(views.begin(), views.end(), expected.begin(), expected.end());
+
+        views.assign(data.begin(), data.end());
+        long long tRadix = measureMs([&]() { StringSort::msdRadixSort(views); });
+        bool radixOk = equal(views.begin(), views.end(), expected.begin(), expected.end());
+
+        vector<uint32_t> order;
+        long long tArgsort = measureMs([&]() { order = StringSort::argsort(data); });
+        bool argsortOk = true;
+        for (size_t i = 0; i < order.size(); i++) {
+            argsortOk = argsortOk && data[order[i]] == expected[i];
+        }
+
+        double megabytes = 0;
+        for (const string& s : data) megabytes += s.size();
+        megabytes /= 1024.0 * 1024.0;
+
+        auto throughput = [megabytes](long long ms) { return ms == 0 ? 0.0 : megabytes / (ms / 1000.0); };
+
+        cout << "  std::sort (string):       " << tStd << " , " << throughput(tStd) << " /" << endl;
+        cout << "  StringSort::sort:         " << tEngine << " , " << throughput(tEngine) << " / ("
+            << (strings == expected ? "OK" : "") << ")" << endl;
+        cout << "  std::sort (string_view):  " << tStdViews << " , " << throughput(tStdViews) << " /" << endl;
+        cout << "   :    " << tMkqs << " , " << throughput(tMkqs) << " / ("
+            << (mkqsOk ? "OK" : "") << ")" << endl;
+        cout << "  MSD radix:                " << tRadix << " , " << throughput(tRadix) << " / ("
+            << (radixOk ? "OK" : "") << ")" << endl;
+        cout << "  argsort:                  " << tArgsort << " , " << throughput(tArgsort) << " / ("
+            << (argsortOk ? "OK" : "") << ")" << endl;
+    }
+
+public:
+    static void compareStringSorts(size_t count = 1000000) {
+        cout << "\n===   ===" << endl;
+
+        mt19937 gen(32);
+        runDataset("", generateNames(count, gen));
+        runDataset("URL", generateUrls(count, gen));
+        runDataset("  ", generateSharedPrefix(count, gen));
+    }
+};
\ No newline at end of file
@@ -0,0 +1,823 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <span>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "Source15.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+//
+// SA[i] -  i-    .  
+//  uint32_t,       4 ;  
+//   .
+
+class SuffixArrayBuilder {
+public:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    // SA-IS (Nong, Zhang, Chan): O(n) , ~8n   
+    static vector<uint32_t> build(string_view text) {
+        checkLength(text);
+        size_t n = text.size();
+        if (n == 0) return {};
+
+        //    1,       0
+        vector<uint32_t> s(n + 1);
+        for (size_t i = 0; i < n; i++) {
+            s[i] = static_cast<uint8_t>(text[i]) + 1u;
+        }
+        s[n] = 0;
+
+        vector<uint32_t> sa(n + 1);
+        sais(s.data(), sa.data(), n + 1, 257);
+
+        // sa[0] -    
+        sa.erase(sa.begin());
+        return sa;
+    }
+
+    //   :     
+    // 4 ,     h -> 2h  
+    //    .  O(n log n),    
+    // ,   SA-IS  .
+    static vector<uint32_t> buildParallel(string_view text, unsigned threads = 0) {
+        checkLength(text);
+        threads = threadCount(threads);
+        size_t n = text.size();
+        if (n == 0) return {};
+
+        //    4 ; 0  "  "
+        vector<KeyedPosition> items(n);
+        parallelFor(threads, n, [&](size_t from, size_t to) {
+            for (size_t i = from; i < to; i++) {
+                uint64_t key = 0;
+                for (size_t k = 0; k < 4; k++) {
+                    key = key * 257 + (i + k < n ? static_cast<uint8_t>(text[i + k]) + 1u : 0u);
+                }
+                items[i] = { key, static_cast<uint32_t>(i) };
+            }
+            });
+        parallelSort(items, threads);
+
+        //   = 1 +     SA.   
+        //   ,    .
+        vector<uint32_t> sa(n);
+        vector<uint32_t> rank(n);
+        uint32_t groupStart = 0;
+        for (size_t j = 0; j < n; j++) {
+            if (j > 0 && items[j].key != items[j - 1].key) groupStart = static_cast<uint32_t>(j);
+            sa[j] = items[j].position;
+            rank[sa[j]] = groupStart + 1;
+        }
+        items.clear();
+        items.shrink_to_fit();
+
+        vector<uint32_t> second(n);
+        for (size_t h = 4; ; h *= 2) {
+            vector<pair<uint32_t, uint32_t>> groups = unsortedGroups(sa, rank);
+            if (groups.empty()) break;
+
+            //  1:      -    rank
+            parallelFor(threads, groups.size(), [&](size_t from, size_t to) {
+                for (size_t g = from; g < to; g++) {
+                    for (uint32_t j = groups[g].first; j < groups[g].second; j++) {
+                        size_t next = sa[j] + h;
+                        second[j] = next < n ? rank[next] : 0;
+                    }
+                }
+                });
+
+            //  2:        .
+            //   ,      .
+            size_t largeGroup = max<size_t>(n / (2 * threads), 1 << 16);
+            vector<size_t> large;
+            for (size_t g = 0; g < groups.size(); g++) {
+                if (groups[g].second - groups[g].first > largeGroup) large.push_back(g);
+            }
+
+            parallelFor(threads, groups.size(), [&](size_t from, size_t to) {
+                vector<KeyedPosition> buffer;
+                for (size_t g = from; g < to; g++) {
+                    if (groups[g].second - groups[g].first > largeGroup) continue;
+                    sortGroup(groups[g], sa, rank, second, buffer, 1);
+                }
+                });
+
+            //   ( )     
+            vector<KeyedPosition> buffer;
+            for (size_t g : large) {
+                sortGroup(groups[g], sa, rank, second, buffer, threads);
+            }
+        }
+        return sa;
+    }
+
+    // LCP[i] -     SA[i-1]  SA[i], LCP[0] = 0.
+    //  :     i  i+1  
+    //     1.       
+    //        .
+    static vector<uint32_t> buildLcp(string_view text, span<const uint32_t> sa, unsigned threads = 1) {
+        size_t n = text.size();
+        if (sa.size() != n) {
+            throw invalid_argument("       ");
+        }
+        threads = threadCount(threads);
+
+        vector<uint32_t> rank(n);
+        parallelFor(threads, n, [&](size_t from, size_t to) {
+            for (size_t i = from; i < to; i++) rank[sa[i]] = static_cast<uint32_t>(i);
+            });
+
+        vector<uint32_t> lcp(n, 0);
+        parallelFor(threads, n, [&](size_t from, size_t to) {
+            size_t h = 0;
+            for (size_t i = from; i < to; i++) {
+                if (rank[i] == 0) {
+                    h = 0;
+                    continue;
+                }
+                size_t j = sa[rank[i] - 1];
+                while (i + h < n && j + h < n && text[i + h] == text[j + h]) h++;
+                lcp[rank[i]] = static_cast<uint32_t>(h);
+                if (h > 0) h--;
+            }
+            });
+        return lcp;
+    }
+
+    static unsigned threadCount(unsigned requested) {
+        if (requested != 0) return requested;
+        return max(1u, thread::hardware_concurrency());
+    }
+
+private:
+    struct KeyedPosition {
+        uint64_t key;
+        uint32_t position;
+
+        bool operator<(const KeyedPosition& other) const {
+            return key != other.key ? key < other.key : position < other.position;
+        }
+    };
+
+    static void checkLength(string_view text) {
+        if (text.size() >= EMPTY - 1) {
+            throw invalid_argument("  4 :    ");
+        }
+    }
+
+    // ---------- SA-IS ----------
+
+    //     s[0..n),  s[n-1] = 0 -  .
+    //        sa.
+    static void sais(const uint32_t* s, uint32_t* sa, size_t n, size_t alphabet) {
+        // S-:   ; L- - 
+        vector<uint8_t> isS(n);
+        isS[n - 1] = 1;
+        for (size_t i = n - 1; i-- > 0;) {
+            isS[i] = s[i] < s[i + 1] || (s[i] == s[i + 1] && isS[i + 1]);
+        }
+        auto isLms = [&](size_t i) { return i > 0 && isS[i] && !isS[i - 1]; };
+
+        vector<uint32_t> bucketSizes(alphabet, 0);
+        for (size_t i = 0; i < n; i++) bucketSizes[s[i]]++;
+        vector<uint32_t> bucket(alphabet);
+
+        //  1: LMS-   ,   
+        bucketEnds(bucketSizes, bucket);
+        fill(sa, sa + n, EMPTY);
+        for (size_t i = 1; i < n; i++) {
+            if (isLms(i)) sa[--bucket[s[i]]] = static_cast<uint32_t>(i);
+        }
+        induce(s, sa, n, isS, bucketSizes, bucket);
+
+        //  2:  LMS-    sa  
+        size_t lmsCount = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (isLms(sa[i])) sa[lmsCount++] = sa[i];
+        }
+        fill(sa + lmsCount, sa + n, EMPTY);
+
+        uint32_t names = 0;
+        uint32_t prev = EMPTY;
+        for (size_t i = 0; i < lmsCount; i++) {
+            uint32_t pos = sa[i];
+            if (prev == EMPTY || !equalLmsSubstrings(s, isS, n, prev, pos)) {
+                names++;
+                prev = pos;
+            }
+            //  LMS-     2,  pos / 2 
+            sa[lmsCount + pos / 2] = names - 1;
+        }
+        for (size_t i = n, j = n; i-- > lmsCount;) {
+            if (sa[i] != EMPTY) sa[--j] = sa[i];
+        }
+
+        //  3:  LMS- -   ,   
+        uint32_t* reduced = sa + n - lmsCount;
+        if (names < lmsCount) {
+            sais(reduced, sa, lmsCount, names);
+        }
+        else {
+            for (size_t i = 0; i < lmsCount; i++) sa[reduced[i]] = static_cast<uint32_t>(i);
+        }
+
+        //  4:     ->   s,  
+        for (size_t i = 1, j = 0; i < n; i++) {
+            if (isLms(i)) reduced[j++] = static_cast<uint32_t>(i);
+        }
+        for (size_t i = 0; i < lmsCount; i++) sa[i] = reduced[sa[i]];
+        fill(sa + lmsCount, sa + n, EMPTY);
+
+        bucketEnds(bucketSizes, bucket);
+        for (size_t i = lmsCount; i-- > 0;) {
+            uint32_t pos = sa[i];
+            sa[i] = EMPTY;
+            sa[--bucket[s[pos]]] = pos;
+        }
+        induce(s, sa, n, isS, bucketSizes, bucket);
+    }
+
+    static void bucketStarts(const vector<uint32_t>& sizes, vector<uint32_t>& bucket) {
+        uint32_t sum = 0;
+        for (size_t c = 0; c < sizes.size(); c++) {
+            bucket[c] = sum;
+            sum += sizes[c];
+        }
+    }
+
+    static void bucketEnds(const vector<uint32_t>& sizes, vector<uint32_t>& bucket) {
+        uint32_t sum = 0;
+        for (size_t c = 0; c < sizes.size(); c++) {
+            sum += sizes[c];
+            bucket[c] = sum;
+        }
+    }
+
+    // L-     , S-    
+    static void induce(const uint32_t* s, uint32_t* sa, size_t n, const vector<uint8_t>& isS,
+        const vector<uint32_t>& sizes, vector<uint32_t>& bucket) {
+        bucketStarts(sizes, bucket);
+        for (size_t i = 0; i < n; i++) {
+            if (sa[i] == EMPTY || sa[i] == 0) continue;
+            uint32_t j = sa[i] - 1;
+            if (!isS[j]) sa[bucket[s[j]]++] = j;
+        }
+
+        bucketEnds(sizes, bucket);
+        for (size_t i = n; i-- > 0;) {
+            if (sa[i] == EMPTY || sa[i] == 0) continue;
+            uint32_t j = sa[i] - 1;
+            if (isS[j]) sa[--bucket[s[j]]] = j;
+        }
+    }
+
+    static bool equalLmsSubstrings(const uint32_t* s, const vector<uint8_t>& isS, size_t n, size_t a, size_t b) {
+        for (size_t d = 0; a + d < n && b + d < n; d++) {
+            if (s[a + d] != s[b + d] || isS[a + d] != isS[b + d]) return false;
+            bool endA = d > 0 && isS[a + d] && !isS[a + d - 1];
+            bool endB = d > 0 && isS[b + d] && !isS[b + d - 1];
+            if (endA || endB) return endA && endB;
+        }
+        return false;
+    }
+
+    // ----------   ----------
+
+    //   SA      1
+    static vector<pair<uint32_t, uint32_t>> unsortedGroups(const vector<uint32_t>& sa, const vector<uint32_t>& rank) {
+        vector<pair<uint32_t, uint32_t>> groups;
+        size_t n = sa.size();
+        size_t start = 0;
+        for (size_t j = 1; j <= n; j++) {
+            if (j == n || rank[sa[j]] != rank[sa[start]]) {
+                if (j - start > 1) groups.push_back({ static_cast<uint32_t>(start), static_cast<uint32_t>(j) });
+                start = j;
+            }
+        }
+        return groups;
+    }
+
+    static void sortGroup(pair<uint32_t, uint32_t> group, vector<uint32_t>& sa, vector<uint32_t>& rank,
+        const vector<uint32_t>& second, vector<KeyedPosition>& buffer, unsigned threads) {
+        uint32_t first = group.first;
+        uint32_t last = group.second;
+
+        buffer.resize(last - first);
+        for (uint32_t j = first; j < last; j++) {
+            buffer[j - first] = { second[j], sa[j] };
+        }
+        if (threads > 1) {
+            parallelSort(buffer, threads);
+        }
+        else {
+            sort(buffer.begin(), buffer.end());
+        }
+
+        uint32_t subgroupStart = first;
+        for (uint32_t j = first; j < last; j++) {
+            if (j > first && buffer[j - first].key != buffer[j - first - 1].key) subgroupStart = j;
+            sa[j] = buffer[j - first].position;
+            rank[sa[j]] = subgroupStart + 1;
+        }
+    }
+
+    // ----------   ----------
+
+    //  [0, count)  threads  
+    template<typename Func>
+    static void parallelFor(unsigned threads, size_t count, Func func) {
+        if (threads <= 1 || count < 2 * threads) {
+            func(size_t(0), count);
+            return;
+        }
+        vector<thread> workers;
+        size_t chunk = (count + threads - 1) / threads;
+        for (size_t from = 0; from < count; from += chunk) {
+            size_t to = min(count, from + chunk);
+            workers.emplace_back([&func, from, to]() { func(from, to); });
+        }
+        for (thread& worker : workers) worker.join();
+    }
+
+    //       
+    static void parallelSort(vector<KeyedPosition>& items, unsigned threads) {
+        size_t n = items.size();
+        size_t chunk = (n + threads - 1) / threads;
+        if (threads <= 1 || chunk < 4096) {
+            sort(items.begin(), items.end());
+            return;
+        }
+
+        parallelFor(threads, threads, [&](size_t from, size_t to) {
+            for (size_t t = from; t < to; t++) {
+                size_t begin = min(n, t * chunk);
+                size_t end = min(n, begin + chunk);
+                sort(items.begin() + begin, items.begin() + end);
+            }
+            });
+
+        vector<KeyedPosition> merged(n);
+        for (size_t width = chunk; width < n; width *= 2) {
+            size_t pairs = (n + 2 * width - 1) / (2 * width);
+            parallelFor(threads, pairs, [&](size_t from, size_t to) {
+                for (size_t p = from; p < to; p++) {
+                    size_t begin = p * 2 * width;
+                    size_t middle = min(n, begin + width);
+                    size_t end = min(n, begin + 2 * width);
+                    merge(items.begin() + begin, items.begin() + middle,
+                        items.begin() + middle, items.begin() + end, merged.begin() + begin);
+                }
+                });
+            items.swap(merged);
+        }
+    }
+};
+
+// ====================    ====================
+//
+//   ,    SortedFileHeader:    ,
+//    4096    mmap  .
+//
+//  [0 .. 4096)         TextIndexHeader
+//  [textOffset ..)    
+//  [saOffset ..)       , uint32 little-endian
+//  [lcpOffset ..)       LCP, uint32
+
+struct TextIndexHeader {
+    static constexpr uint32_t MAGIC = 0x58535242;   // "BRSX"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t FLAG_HAS_LCP = 1;
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t flags;
+    uint64_t textLength;
+    uint64_t textOffset;
+    uint64_t saOffset;
+    uint64_t lcpOffset;
+    uint64_t textChecksum;
+    uint64_t saChecksum;
+    uint64_t lcpChecksum;
+    uint64_t headerChecksum;  //     
+};
+
+// ====================   ====================
+
+class SuffixArrayIndex {
+public:
+    struct BuildOptions {
+        bool withLcp = true;     //   longestRepeat;     4n  
+        bool parallel = false;   //    SA-IS
+        unsigned threads = 0;    // 0 -   
+    };
+
+    struct OpenOptions {
+        bool verifyData = false;   //    (  )
+        bool prefault = false;     //    
+        bool hugePages = false;
+    };
+
+    //  [first, last)  
+    struct Range {
+        size_t first = 0;
+        size_t last = 0;
+        size_t size() const { return last - first; }
+    };
+
+private:
+    //    ( build),    ( open)
+    vector<char> ownedText;
+    vector<uint32_t> ownedSa;
+    vector<uint32_t> ownedLcp;
+    MemoryMappedFile file;
+
+    string_view text;
+    span<const uint32_t> sa;
+    span<const uint32_t> lcp;
+
+    //   pattern.size()    ,
+    //    from (    ).
+    // matched -   ,  -  .
+    int compareSuffix(uint32_t pos, string_view pattern, size_t from, size_t& matched) const {
+        size_t available = text.size() - pos;
+        size_t limit = min(available, pattern.size());
+        size_t k = from;
+        while (k < limit && text[pos + k] == pattern[k]) k++;
+        matched = k;
+
+        if (k == pattern.size()) return 0;
+        if (k == available) return -1;   //    
+        return static_cast<uint8_t>(text[pos + k]) < static_cast<uint8_t>(pattern[k]) ? -1 : 1;
+    }
+
+    //       :  
+    //         min(lcpLow, lcpHigh)
+    // . upper = false -   >= , true -  > .
+    size_t bound(string_view pattern, size_t low, size_t high, bool upper) const {
+        size_t lcpLow = 0;
+        size_t lcpHigh = 0;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            size_t matched;
+            int cmp = compareSuffix(sa[mid], pattern, min(lcpLow, lcpHigh), matched);
+            if (cmp < 0 || (upper && cmp == 0)) {
+                low = mid + 1;
+                lcpLow = matched;
+            }
+            else {
+                high = mid;
+                lcpHigh = matched;
+            }
+        }
+        return low;
+    }
+
+    static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static void writePadding(ofstream& out, uint64_t bytes) {
+        static const char zeros[4096] = {};
+        while (bytes > 0) {
+            uint64_t chunk = min<uint64_t>(bytes, sizeof(zeros));
+            out.write(zeros, chunk);
+            bytes -= chunk;
+        }
+    }
+
+public:
+    SuffixArrayIndex() = default;
+
+    //     :  ,
+    //   ( vector     )
+    SuffixArrayIndex(const SuffixArrayIndex&) = delete;
+    SuffixArrayIndex& operator=(const SuffixArrayIndex&) = delete;
+    SuffixArrayIndex(SuffixArrayIndex&&) noexcept = default;
+    SuffixArrayIndex& operator=(SuffixArrayIndex&&) noexcept = default;
+
+    static SuffixArrayIndex build(string_view source) {
+        return build(source, BuildOptions());
+    }
+
+    static SuffixArrayIndex build(string_view source, const BuildOptions& options) {
+        SuffixArrayIndex index;
+        index.ownedText.assign(source.begin(), source.end());
+        index.text = string_view(index.ownedText.data(), index.ownedText.size());
+
+        index.ownedSa = options.parallel
+            ? SuffixArrayBuilder::buildParallel(index.text, options.threads)
+            : SuffixArrayBuilder::build(index.text);
+        index.sa = index.ownedSa;
+
+        if (options.withLcp) {
+            unsigned threads = options.parallel ? options.threads : 1;
+            index.ownedLcp = SuffixArrayBuilder::buildLcp(index.text, index.sa, threads);
+            index.lcp = index.ownedLcp;
+        }
+        return index;
+    }
+
+    //    :      
+    static SuffixArrayIndex open(const string& path) {
+        return open(path, OpenOptions());
+    }
+
+    static SuffixArrayIndex open(const string& path, const OpenOptions& options) {
+        SuffixArrayIndex index;
+        index.file.open(path);
+
+        const uint8_t* base = index.file.data();
+        size_t fileBytes = index.file.size();
+        if (fileBytes < sizeof(TextIndexHeader)) {
+            throw runtime_error("    : " + path);
+        }
+
+        const TextIndexHeader* header = reinterpret_cast<const TextIndexHeader*>(base);
+        if (header->magic != TextIndexHeader::MAGIC) {
+            throw runtime_error("  : " + path);
+        }
+        if (header->version != TextIndexHeader::VERSION || header->headerSize != sizeof(TextIndexHeader)) {
+            throw runtime_error("  : " + to_string(header->version));
+        }
+        if (header->headerChecksum != SortedFileChecksum::compute(header, offsetof(TextIndexHeader, headerChecksum))) {
+            throw runtime_error(" : " + path);
+        }
+
+        uint64_t n = header->textLength;
+        bool hasLcp = (header->flags & TextIndexHeader::FLAG_HAS_LCP) != 0;
+        if (header->textOffset + n > fileBytes
+            || header->saOffset % 4096 != 0 || header->saOffset + n * sizeof(uint32_t) > fileBytes
+            || (hasLcp && (header->lcpOffset % 4096 != 0 || header->lcpOffset + n * sizeof(uint32_t) > fileBytes))) {
+            throw runtime_error("     : " + path);
+        }
+
+        index.text = string_view(reinterpret_cast<const char*>(base + header->textOffset), n);
+        index.sa = span<const uint32_t>(reinterpret_cast<const uint32_t*>(base + header->saOffset), n);
+        if (hasLcp) {
+            index.lcp = span<const uint32_t>(reinterpret_cast<const uint32_t*>(base + header->lcpOffset), n);
+        }
+
+        if (options.verifyData) {
+            if (SortedFileChecksum::compute(index.text.data(), index.text.size()) != header->textChecksum
+                || SortedFileChecksum::compute(index.sa.data(), index.sa.size_bytes()) != header->saChecksum
+                || (hasLcp && SortedFileChecksum::compute(index.lcp.data(), index.lcp.size_bytes()) != header->lcpChecksum)) {
+                throw runtime_error("   : " + path);
+            }
+        }
+
+        index.file.advise(MemoryMappedFile::AccessPattern::Random, options.hugePages);
+        if (options.prefault) {
+            index.file.prefault();
+        }
+        return index;
+    }
+
+    void save(const string& path) const {
+        TextIndexHeader header = {};
+        header.magic = TextIndexHeader::MAGIC;
+        header.version = TextIndexHeader::VERSION;
+        header.headerSize = sizeof(TextIndexHeader);
+        header.flags = lcp.empty() ? 0 : TextIndexHeader::FLAG_HAS_LCP;
+        header.textLength = text.size();
+        header.textOffset = alignUp(sizeof(TextIndexHeader), 4096);
+        header.saOffset = alignUp(header.textOffset + text.size(), 4096);
+        header.lcpOffset = alignUp(header.saOffset + sa.size_bytes(), 4096);
+        header.textChecksum = SortedFileChecksum::compute(text.data(), text.size());
+        header.saChecksum = SortedFileChecksum::compute(sa.data(), sa.size_bytes());
+        header.lcpChecksum = SortedFileChecksum::compute(lcp.data(), lcp.size_bytes());
+        header.headerChecksum = SortedFileChecksum::compute(&header, offsetof(TextIndexHeader, headerChecksum));
+
+        //   + ,   SortedArrayFileWriter
+        string tempPath = path + ".tmp";
+        {
+            ofstream out(tempPath, ios::binary | ios::trunc);
+            if (!out) {
+                throw runtime_error("   : " + tempPath);
+            }
+
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            writePadding(out, header.textOffset - sizeof(header));
+            out.write(text.data(), text.size());
+            writePadding(out, header.saOffset - (header.textOffset + text.size()));
+            out.write(reinterpret_cast<const char*>(sa.data()), sa.size_bytes());
+            if (!lcp.empty()) {
+                writePadding(out, header.lcpOffset - (header.saOffset + sa.size_bytes()));
+                out.write(reinterpret_cast<const char*>(lcp.data()), lcp.size_bytes());
+            }
+
+            if (!out) {
+                throw runtime_error("  : " + tempPath);
+            }
+        }
+
+        remove(path.c_str());
+        if (rename(tempPath.c_str(), path.c_str()) != 0) {
+            throw runtime_error("   " + tempPath + "  " + path);
+        }
+    }
+
+    // ----------  ----------
+
+    //  ,   , - O(m log n)  ,
+    //     O(m + log n)    
+    Range equalRange(string_view pattern) const {
+        if (pattern.empty()) return { 0, sa.size() };
+        size_t first = bound(pattern, 0, sa.size(), false);
+        size_t last = bound(pattern, first, sa.size(), true);
+        return { first, last };
+    }
+
+    size_t count(string_view pattern) const {
+        return equalRange(pattern).size();
+    }
+
+    bool contains(string_view pattern) const {
+        return count(pattern) > 0;
+    }
+
+    //     (  limit )
+    vector<uint32_t> locate(string_view pattern, size_t limit = SIZE_MAX) const {
+        Range range = equalRange(pattern);
+        size_t take = min(range.size(), limit);
+        vector<uint32_t> positions(sa.begin() + range.first, sa.begin() + range.first + take);
+        sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    //   ,     -  LCP
+    string_view longestRepeat() const {
+        if (lcp.empty()) {
+            throw runtime_error("    LCP");
+        }
+        auto best = max_element(lcp.begin(), lcp.end());
+        if (best == lcp.end() || *best == 0) return {};
+        return text.substr(sa[best - lcp.begin()], *best);
+    }
+
+    string_view getText() const { return text; }
+    span<const uint32_t> suffixArray() const { return sa; }
+    span<const uint32_t> lcpArray() const { return lcp; }
+    size_t size() const { return text.size(); }
+    bool isMapped() const { return file.isOpen(); }
+
+    size_t memoryBytes() const {
+        return text.size() + sa.size_bytes() + lcp.size_bytes();
+    }
+};
+
+// ====================    ====================
+
+class SuffixArrayBenchmark {
+private:
+    //  :   ,    
+    static string generateLog(size_t bytes, mt19937& gen) {
+        const vector<string> levels = { "INFO", "WARN", "ERROR", "DEBUG" };
+        const vector<string> actions = { "login", "logout", "upload", "download", "delete", "search" };
+        uniform_int_distribution<int> user(1, 50000);
+        uniform_int_distribution<int> octet(0, 255);
+        uniform_int_distribution<int> pick(0, 1000);
+
+        string log;
+        log.reserve(bytes + 128);
+        long long second = 0;
+        while (log.size() < bytes) {
+            second += pick(gen) % 3;
+            log += "2026-10-" + to_string(10 + second / 86400 % 20) + " "
+                + to_string(second / 3600 % 24) + ":" + to_string(second / 60 % 60) + ":" + to_string(second % 60)
+                + " " + levels[pick(gen) % levels.size()]
+                + " user=" + to_string(user(gen))
+                + " action=" + actions[pick(gen) % actions.size()]
+                + " ip=10." + to_string(octet(gen)) + "." + to_string(octet(gen)) + "." + to_string(octet(gen)) + "\n";
+        }
+        return log;
+    }
+
+    static size_t naiveCount(const string& text, const string& pattern) {
+        size_t found = 0;
+        for (size_t pos = text.find(pattern); pos != string::npos; pos = text.find(pattern, pos + 1)) {
+            found++;
+        }
+        return found;
+    }
+
+public:
+    // SA-IS       
+    static bool verify() {
+        cout << "\n===    ===" << endl;
+
+        mt19937 gen(33);
+        bool correct = true;
+        for (int test = 0; test < 300 && correct; test++) {
+            //      -  
+            int alphabet = 1 + test % 4;
+            size_t length = test % 50 == 0 ? 0 : gen() % 2000;
+            uniform_int_distribution<int> letter(0, alphabet - 1);
+            string text(length, 'a');
+            for (char& c : text) c = static_cast<char>(test % 7 == 0 ? letter(gen) * 100 : 'a' + letter(gen));
+
+            vector<uint32_t> expected(length);
+            for (size_t i = 0; i < length; i++) expected[i] = static_cast<uint32_t>(i);
+            sort(expected.begin(), expected.end(), [&](uint32_t a, uint32_t b) {
+                return string_view(text).substr(a) < string_view(text).substr(b);
+                });
+
+            correct = correct && SuffixArrayBuilder::build(text) == expected;
+            correct = correct && SuffixArrayBuilder::buildParallel(text, 1 + test % 4) == expected;
+
+            vector<uint32_t> lcp = SuffixArrayBuilder::buildLcp(text, expected, 1 + test % 3);
+            for (size_t i = 1; i < length && correct; i++) {
+                size_t h = 0;
+                while (expected[i - 1] + h < length && expected[i] + h < length
+                    && text[expected[i - 1] + h] == text[expected[i] + h]) h++;
+                correct = lcp[i] == h;
+            }
+
+            SuffixArrayIndex index = SuffixArrayIndex::build(text);
+            for (int q = 0; q < 20 && correct; q++) {
+                string pattern(1 + gen() % 6, 'a');
+                for (char& c : pattern) c = static_cast<char>(test % 7 == 0 ? letter(gen) * 100 : 'a' + letter(gen));
+                vector<uint32_t> positions;
+                for (size_t pos = text.find(pattern); pos != string::npos; pos = text.find(pattern, pos + 1)) {
+                    positions.push_back(static_cast<uint32_t>(pos));
+                }
+                correct = index.locate(pattern) == positions;
+            }
+        }
+        cout << "   : " << (correct ? "OK" : "") << endl;
+        return correct;
+    }
+
+    static void compareWithScan(size_t bytes = 50000000) {
+        cout << "\n===  :   vs string::find (" << bytes / 1000000 << " ) ===" << endl;
+
+        mt19937 gen(2026);
+        string log = generateLog(bytes, gen);
+
+        auto start = high_resolution_clock::now();
+        SuffixArrayIndex index = SuffixArrayIndex::build(log);
+        auto end = high_resolution_clock::now();
+        double buildMs = duration_cast<milliseconds>(end - start).count();
+        cout << "  SA-IS + LCP: " << buildMs << " , " << index.memoryBytes() / (1024 * 1024) << " " << endl;
+
+        SuffixArrayIndex::BuildOptions parallel;
+        parallel.parallel = true;
+        start = high_resolution_clock::now();
+        SuffixArrayIndex parallelIndex = SuffixArrayIndex::build(log, parallel);
+        end = high_resolution_clock::now();
+        bool same = equal(index.suffixArray().begin(), index.suffixArray().end(), parallelIndex.suffixArray().begin(), parallelIndex.suffixArray().end())
+            && equal(index.lcpArray().begin(), index.lcpArray().end(), parallelIndex.lcpArray().begin(), parallelIndex.lcpArray().end());
+        cout << "    (" << SuffixArrayBuilder::threadCount(0) << " ): "
+            << duration_cast<milliseconds>(end - start).count() << "  (" << (same ? "OK" : "") << ")" << endl;
+
+        // :    
+        vector<string> patterns = { "user=4242 ", "action=delete ip=10.1.", "ERROR user=1", "10.255.255.255", "no such text" };
+        for (const string& pattern : patterns) {
+            start = high_resolution_clock::now();
+            size_t scanned = naiveCount(log, pattern);
+            end = high_resolution_clock::now();
+            double scanUs = duration_cast<microseconds>(end - start).count();
+
+            const int repeats = 10000;
+            size_t counted = 0;
+            start = high_resolution_clock::now();
+            for (int r = 0; r < repeats; r++) counted = index.count(pattern);
+            end = high_resolution_clock::now();
+            double indexUs = duration_cast<nanoseconds>(end - start).count() / 1000.0 / repeats;
+
+            cout << "  \"" << pattern << "\": " << counted << " ,  " << indexUs
+                << " ,  " << scanUs << "  (" << (counted == scanned ? "OK" : "") << ")" << endl;
+        }
+
+        string_view repeat = index.longestRepeat();
+        cout << "    : " << repeat.size() << " " << endl;
+
+        //     mmap
+        string path = "text_index_bench.bsx";
+        index.save(path);
+
+        start = high_resolution_clock::now();
+        SuffixArrayIndex mapped = SuffixArrayIndex::open(path);
+        end = high_resolution_clock::now();
+        bool mappedOk = mapped.count("user=4242 ") == index.count("user=4242 ") && mapped.getText() == index.getText();
+        cout << "    mmap: " << duration_cast<microseconds>(end - start).count() << "  vs  "
+            << buildMs << "  (" << (mappedOk ? "OK" : "") << ")" << endl;
+
+        remove(path.c_str());
+    }
+};
\ No newline at end of file
@@ -0,0 +1,569 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Teddy needs PSHUFB (SSSE3); MSVC has no SSSE3 macro, AVX implies it
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#ifndef HAS_SSSE3
+#define HAS_SSSE3
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace MathLib {
+
+    // ============= MultiPatternMatcher =============
+    //
+    // Aho-Corasick automaton for scanning text for many keywords at once.
+    // Every byte costs one table lookup regardless of the number of patterns.
+    // Small pattern sets are additionally prefiltered with Teddy (SIMD nibble
+    // masks) when the whole buffer is available.
+
+    class MultiPatternMatcher {
+    public:
+        struct Options {
+            bool caseInsensitive = false;   // ASCII case folding
+            bool usePrefilter = true;       // Teddy for small pattern sets (needs SSSE3)
+        };
+
+        struct Match {
+            size_t position;     // Offset of the first byte of the match
+            uint32_t pattern;    // Index in the pattern list
+
+            bool operator==(const Match& other) const {
+                return position == other.position && pattern == other.pattern;
+            }
+            bool operator<(const Match& other) const {
+                return position != other.position ? position < other.position : pattern < other.pattern;
+            }
+        };
+
+        static constexpr size_t TEDDY_MAX_PATTERNS = 32;
+
+    private:
+        static constexpr int TEDDY_BUCKETS = 8;
+        static constexpr int TEDDY_MAX_PREFIX = 3;
+
+        std::vector<std::string> patterns;   // Already case-folded if needed
+        Options options;
+
+        // Byte -> character class. Bytes that occur in no pattern share class 0,
+        // so the table has a column per distinct pattern byte, not 256.
+        uint8_t fold[256];
+        uint16_t classOf[256];
+        uint32_t classCount = 0;
+
+        // Dense DFA: row of state s starts at s (ids are pre-multiplied by
+        // classCount). States with output are numbered last, so a match test
+        // is one comparison with firstMatchState.
+        std::vector<uint32_t> delta;
+        uint32_t firstMatchState = 0;
+        std::vector<uint32_t> outputStart;   // Per state row, into outputs
+        std::vector<uint32_t> outputs;
+
+        // Teddy tables: for each prefix byte, masks of buckets by low/high nibble
+        bool teddyEnabled = false;
+        int teddyPrefix = 0;
+        alignas(16) uint8_t teddyLow[TEDDY_MAX_PREFIX][16];
+        alignas(16) uint8_t teddyHigh[TEDDY_MAX_PREFIX][16];
+        std::vector<uint32_t> bucketPatterns[TEDDY_BUCKETS];
+
+        void buildAutomaton() {
+            // Character classes
+            std::fill(std::begin(classOf), std::end(classOf), 0);
+            classCount = 1;
+            for (const std::string& p : patterns) {
+                for (unsigned char c : p) {
+                    if (classOf[c] == 0) classOf[c] = static_cast<uint16_t>(classCount++);
+                }
+            }
+            for (int c = 0; c < 256; ++c) {
+                classOf[c] = classOf[fold[c]];
+            }
+
+            // Trie; EMPTY marks a missing edge until failure links fill it
+            const uint32_t EMPTY = UINT32_MAX;
+            std::vector<uint32_t> trie(classCount, EMPTY);
+            std::vector<std::vector<uint32_t>> own(1);
+            for (uint32_t id = 0; id < patterns.size(); ++id) {
+                uint32_t state = 0;
+                for (unsigned char c : patterns[id]) {
+                    uint32_t& next = trie[state * classCount + classOf[c]];
+                    if (next == EMPTY) {
+                        next = static_cast<uint32_t>(own.size());
+                        own.emplace_back();
+                        trie.resize(trie.size() + classCount, EMPTY);
+                    }
+                    state = trie[state * classCount + classOf[c]];
+                }
+                own[state].push_back(id);
+            }
+            size_t stateCount = own.size();
+
+            // BFS: failure links, missing edges borrowed from the failure state,
+            // outputs inherited along failure links
+            std::vector<uint32_t> failure(stateCount, 0);
+            std::vector<uint32_t> order;
+            order.reserve(stateCount);
+            for (uint32_t c = 0; c < classCount; ++c) {
+                uint32_t& next = trie[c];
+                if (next == EMPTY) {
+                    next = 0;
+                }
+                else {
+                    order.push_back(next);
+                }
+            }
+            for (size_t head = 0; head < order.size(); ++head) {
+                uint32_t state = order[head];
+                const std::vector<uint32_t>& inherited = own[failure[state]];
+                own[state].insert(own[state].end(), inherited.begin(), inherited.end());
+
+                for (uint32_t c = 0; c < classCount; ++c) {
+                    uint32_t& next = trie[state * classCount + c];
+                    uint32_t viaFailure = trie[failure[state] * classCount + c];
+                    if (next == EMPTY) {
+                        next = viaFailure;
+                    }
+                    else {
+                        failure[next] = viaFailure;
+                        order.push_back(next);
+                    }
+                }
+            }
+
+            // Renumber: states without output first, then states with output
+            std::vector<uint32_t> newId(stateCount);
+            uint32_t nextId = 0;
+            for (size_t s = 0; s < stateCount; ++s) {
+                if (own[s].empty()) newId[s] = nextId++;
+            }
+            firstMatchState = nextId * classCount;
+            for (size_t s = 0; s < stateCount; ++s) {
+                if (!own[s].empty()) newId[s] = nextId++;
+            }
+
+            delta.assign(stateCount * classCount, 0);
+            std::vector<std::vector<uint32_t>*> byNewId(stateCount);
+            for (size_t s = 0; s < stateCount; ++s) {
+                for (uint32_t c = 0; c < classCount; ++c) {
+                    delta[newId[s] * classCount + c] = newId[trie[s * classCount + c]] * classCount;
+                }
+                byNewId[newId[s]] = &own[s];
+            }
+
+            outputStart.assign(stateCount + 1, 0);
+            outputs.clear();
+            for (size_t s = 0; s < stateCount; ++s) {
+                outputStart[s] = static_cast<uint32_t>(outputs.size());
+                outputs.insert(outputs.end(), byNewId[s]->begin(), byNewId[s]->end());
+            }
+            outputStart[stateCount] = static_cast<uint32_t>(outputs.size());
+        }
+
+        void buildTeddy() {
+            teddyEnabled = false;
+#ifdef HAS_SSSE3
+            if (!options.usePrefilter || patterns.size() > TEDDY_MAX_PATTERNS) return;
+
+            size_t shortest = patterns[0].size();
+            for (const std::string& p : patterns) shortest = std::min(shortest, p.size());
+            teddyPrefix = static_cast<int>(std::min<size_t>(shortest, TEDDY_MAX_PREFIX));
+
+            // Patterns with equal prefixes share a bucket: fewer false candidates
+            std::vector<uint32_t> sorted(patterns.size());
+            for (uint32_t id = 0; id < sorted.size(); ++id) sorted[id] = id;
+            std::sort(sorted.begin(), sorted.end(), [&](uint32_t a, uint32_t b) {
+                return patterns[a].compare(0, teddyPrefix, patterns[b], 0, teddyPrefix) < 0;
+                });
+
+            std::memset(teddyLow, 0, sizeof(teddyLow));
+            std::memset(teddyHigh, 0, sizeof(teddyHigh));
+            for (std::vector<uint32_t>& bucket : bucketPatterns) bucket.clear();
+
+            for (size_t i = 0; i < sorted.size(); ++i) {
+                uint32_t id = sorted[i];
+                int bucket = static_cast<int>(i * TEDDY_BUCKETS / sorted.size());
+                bucketPatterns[bucket].push_back(id);
+
+                for (int k = 0; k < teddyPrefix; ++k) {
+                    // Both cases of a folded letter must hit the bucket
+                    for (int c = 0; c < 256; ++c) {
+                        if (fold[c] != static_cast<unsigned char>(patterns[id][k])) continue;
+                        teddyLow[k][c & 15] |= static_cast<uint8_t>(1 << bucket);
+                        teddyHigh[k][c >> 4] |= static_cast<uint8_t>(1 << bucket);
+                    }
+                }
+            }
+            teddyEnabled = true;
+#endif
+        }
+
+        bool matchesAt(std::string_view text, size_t position, uint32_t id) const {
+            const std::string& p = patterns[id];
+            if (position + p.size() > text.size()) return false;
+            for (size_t k = 0; k < p.size(); ++k) {
+                if (fold[static_cast<unsigned char>(text[position + k])] != static_cast<unsigned char>(p[k])) return false;
+            }
+            return true;
+        }
+
+        // Runs the automaton from state over text; positions are reported
+        // relative to base (the stream offset of text[0])
+        template<typename Callback>
+        uint32_t run(uint32_t state, std::string_view text, size_t base, Callback& callback) const {
+            const uint32_t* table = delta.data();
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+            for (size_t i = 0; i < text.size(); ++i) {
+                state = table[state + classOf[bytes[i]]];
+                if (state >= firstMatchState) {
+                    uint32_t row = state / classCount;
+                    for (uint32_t k = outputStart[row]; k < outputStart[row + 1]; ++k) {
+                        uint32_t id = outputs[k];
+                        callback(Match{ base + i + 1 - patterns[id].size(), id });
+                    }
+                }
+            }
+            return state;
+        }
+
+#ifdef HAS_SSSE3
+        // Bucket bits of candidate starts text[i..i+16)
+        __m128i teddyCandidates(const char* block) const {
+            const __m128i nibble = _mm_set1_epi8(0x0f);
+            __m128i result = _mm_set1_epi8(static_cast<char>(0xff));
+            for (int k = 0; k < teddyPrefix; ++k) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + k));
+                __m128i low = _mm_and_si128(chunk, nibble);
+                __m128i high = _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble);
+                __m128i lowMask = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(teddyLow[k])), low);
+                __m128i highMask = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(teddyHigh[k])), high);
+                result = _mm_and_si128(result, _mm_and_si128(lowMask, highMask));
+            }
+            return result;
+        }
+
+        template<typename Callback>
+        void scanTeddy(std::string_view text, Callback& callback) const {
+            size_t i = 0;
+            if (text.size() >= 16 + TEDDY_MAX_PREFIX) {
+                alignas(16) uint8_t buckets[16];
+                for (; i + 16 + TEDDY_MAX_PREFIX <= text.size(); i += 16) {
+                    __m128i candidates = teddyCandidates(text.data() + i);
+                    int nonZero = ~_mm_movemask_epi8(_mm_cmpeq_epi8(candidates, _mm_setzero_si128())) & 0xffff;
+                    if (nonZero == 0) continue;
+
+                    _mm_store_si128(reinterpret_cast<__m128i*>(buckets), candidates);
+                    while (nonZero != 0) {
+                        int j = lowestSetBit(nonZero);
+                        nonZero &= nonZero - 1;
+                        verifyBuckets(text, i + j, buckets[j], callback);
+                    }
+                }
+            }
+            // Tail shorter than a vector: check every bucket
+            for (; i < text.size(); ++i) {
+                verifyBuckets(text, i, 0xff, callback);
+            }
+        }
+
+        template<typename Callback>
+        void verifyBuckets(std::string_view text, size_t position, uint8_t mask, Callback& callback) const {
+            for (int b = 0; b < TEDDY_BUCKETS; ++b) {
+                if (!(mask & (1 << b))) continue;
+                for (uint32_t id : bucketPatterns[b]) {
+                    if (matchesAt(text, position, id)) callback(Match{ position, id });
+                }
+            }
+        }
+
+        static int lowestSetBit(int value) {
+#ifdef _MSC_VER
+            unsigned long index;
+            _BitScanForward(&index, static_cast<unsigned long>(value));
+            return static_cast<int>(index);
+#else
+            return __builtin_ctz(static_cast<unsigned>(value));
+#endif
+        }
+#endif
+
+    public:
+        explicit MultiPatternMatcher(const std::vector<std::string>& keywords)
+            : MultiPatternMatcher(keywords, Options()) {
+        }
+
+        MultiPatternMatcher(const std::vector<std::string>& keywords, const Options& opts)
+            : options(opts) {
+            if (keywords.empty()) {
+                throw std::invalid_argument("Pattern list is empty");
+            }
+            for (int c = 0; c < 256; ++c) {
+                fold[c] = static_cast<uint8_t>(options.caseInsensitive ? std::tolower(c) : c);
+            }
+            for (const std::string& keyword : keywords) {
+                if (keyword.empty()) {
+                    throw std::invalid_argument("Empty pattern");
+                }
+                std::string folded = keyword;
+                for (char& c : folded) c = static_cast<char>(fold[static_cast<unsigned char>(c)]);
+                patterns.push_back(folded);
+            }
+
+            buildAutomaton();
+            buildTeddy();
+        }
+
+        size_t patternCount() const { return patterns.size(); }
+        size_t stateCount() const { return delta.size() / classCount; }
+        size_t alphabetSize() const { return classCount; }
+        bool usesPrefilter() const { return teddyEnabled; }
+
+        size_t memoryBytes() const {
+            return delta.size() * sizeof(uint32_t) + (outputStart.size() + outputs.size()) * sizeof(uint32_t);
+        }
+
+        // Reports every occurrence (overlapping ones included) of every pattern.
+        // Order of callbacks is not specified; use findAll for a sorted list.
+        template<typename Callback>
+        void scan(std::string_view text, Callback callback) const {
+#ifdef HAS_SSSE3
+            if (teddyEnabled) {
+                scanTeddy(text, callback);
+                return;
+            }
+#endif
+            run(0, text, 0, callback);
+        }
+
+        std::vector<Match> findAll(std::string_view text) const {
+            std::vector<Match> matches;
+            scan(text, [&](const Match& m) { matches.push_back(m); });
+            std::sort(matches.begin(), matches.end());
+            return matches;
+        }
+
+        size_t count(std::string_view text) const {
+            size_t found = 0;
+            scan(text, [&](const Match&) { ++found; });
+            return found;
+        }
+
+        // Stops at the first match: cheaper than count() for filtering lines
+        bool containsAny(std::string_view text) const {
+            uint32_t state = 0;
+            for (unsigned char c : text) {
+                state = delta[state + classOf[c]];
+                if (state >= firstMatchState) return true;
+            }
+            return false;
+        }
+
+        // Streaming: input arrives in chunks of any size; the automaton state
+        // carries over, so matches spanning a chunk boundary are found too.
+        // Positions are offsets from the start of the stream.
+        class Stream {
+        private:
+            const MultiPatternMatcher& matcher;
+            uint32_t state = 0;
+            size_t offset = 0;
+
+        public:
+            explicit Stream(const MultiPatternMatcher& m) : matcher(m) {}
+
+            template<typename Callback>
+            void feed(std::string_view chunk, Callback callback) {
+                state = matcher.run(state, chunk, offset, callback);
+                offset += chunk.size();
+            }
+
+            void reset() {
+                state = 0;
+                offset = 0;
+            }
+
+            size_t bytesConsumed() const { return offset; }
+        };
+
+        Stream stream() const { return Stream(*this); }
+    };
+
+    // ============= MultiPatternBenchmark =============
+
+    class MultiPatternBenchmark {
+    private:
+        static std::string randomWord(std::mt19937& gen, int minLength, int maxLength) {
+            std::uniform_int_distribution<int> length(minLength, maxLength);
+            std::uniform_int_distribution<int> letter('a', 'z');
+            std::string word(length(gen), 'a');
+            for (char& c : word) c = static_cast<char>(letter(gen));
+            return word;
+        }
+
+        static std::string generateLog(size_t bytes, std::mt19937& gen) {
+            std::string text;
+            text.reserve(bytes + 256);
+            std::uniform_int_distribution<int> words(5, 15);
+            while (text.size() < bytes) {
+                int count = words(gen);
+                for (int w = 0; w < count; ++w) {
+                    text += randomWord(gen, 2, 9);
+                    text += ' ';
+                }
+                text += '\n';
+            }
+            return text;
+        }
+
+        static double gbPerSecond(size_t bytes, std::chrono::nanoseconds elapsed) {
+            return static_cast<double>(bytes) / static_cast<double>(elapsed.count());
+        }
+
+        // Baseline: one find() per keyword per line
+        static size_t naiveCount(const std::string& text, const std::vector<std::string>& keywords) {
+            size_t found = 0;
+            size_t lineStart = 0;
+            while (lineStart < text.size()) {
+                size_t lineEnd = text.find('\n', lineStart);
+                if (lineEnd == std::string::npos) lineEnd = text.size();
+                std::string_view line(text.data() + lineStart, lineEnd - lineStart);
+                for (const std::string& keyword : keywords) {
+                    for (size_t pos = line.find(keyword); pos != std::string_view::npos; pos = line.find(keyword, pos + 1)) {
+                        ++found;
+                    }
+                }
+                lineStart = lineEnd + 1;
+            }
+            return found;
+        }
+
+        static void runCase(const std::string& title, const std::string& text, const std::vector<std::string>& keywords) {
+            using namespace std::chrono;
+            std::cout << "\n--- " << title << " (" << keywords.size() << " keywords) ---" << std::endl;
+
+            auto start = high_resolution_clock::now();
+            size_t expected = naiveCount(text, keywords);
+            auto end = high_resolution_clock::now();
+            std::cout << "  find() per keyword: " << gbPerSecond(text.size(), end - start) << " GB/s" << std::endl;
+
+            MultiPatternMatcher::Options automatonOnly;
+            automatonOnly.usePrefilter = false;
+            MultiPatternMatcher automaton(keywords, automatonOnly);
+
+            start = high_resolution_clock::now();
+            size_t found = automaton.count(text);
+            end = high_resolution_clock::now();
+            std::cout << "  Aho-Corasick: " << gbPerSecond(text.size(), end - start) << " GB/s, "
+                << automaton.stateCount() << " states x " << automaton.alphabetSize() << " classes = "
+                << automaton.memoryBytes() / 1024 << " KB (" << (found == expected ? "OK" : "MISMATCH") << ")" << std::endl;
+
+            MultiPatternMatcher prefiltered(keywords);
+            if (prefiltered.usesPrefilter()) {
+                start = high_resolution_clock::now();
+                found = prefiltered.count(text);
+                end = high_resolution_clock::now();
+                std::cout << "  Teddy + verification: " << gbPerSecond(text.size(), end - start) << " GB/s ("
+                    << (found == expected ? "OK" : "MISMATCH") << ")" << std::endl;
+            }
+
+            // Streaming in 4 KB chunks must give the same result
+            MultiPatternMatcher::Stream stream = automaton.stream();
+            size_t streamed = 0;
+            start = high_resolution_clock::now();
+            for (size_t offset = 0; offset < text.size(); offset += 4096) {
+                stream.feed(std::string_view(text).substr(offset, 4096), [&](const MultiPatternMatcher::Match&) { ++streamed; });
+            }
+            end = high_resolution_clock::now();
+            std::cout << "  Streaming, 4 KB chunks: " << gbPerSecond(text.size(), end - start) << " GB/s ("
+                << (streamed == expected ? "OK" : "MISMATCH") << ")" << std::endl;
+        }
+
+    public:
+        // All engines against a brute-force scan on small random inputs
+        static bool verify() {
+            std::cout << "\n=== MULTI-PATTERN MATCHER: CORRECTNESS ===" << std::endl;
+
+            std::mt19937 gen(34);
+            bool correct = true;
+            for (int test = 0; test < 400 && correct; ++test) {
+                std::uniform_int_distribution<int> letter(0, 2 + test % 3);
+                auto word = [&](int length) {
+                    std::string w(length, 'a');
+                    for (char& c : w) c = static_cast<char>((gen() % 2 ? 'a' : 'A') + letter(gen));
+                    return w;
+                };
+
+                std::vector<std::string> keywords;
+                int keywordCount = 1 + static_cast<int>(gen() % (test % 2 ? 40 : 6));
+                for (int k = 0; k < keywordCount; ++k) keywords.push_back(word(1 + static_cast<int>(gen() % 5)));
+                std::string text = word(static_cast<int>(gen() % 300));
+
+                MultiPatternMatcher::Options opts;
+                opts.caseInsensitive = test % 3 == 0;
+                opts.usePrefilter = test % 4 != 1;
+                MultiPatternMatcher matcher(keywords, opts);
+
+                std::string haystack = text;
+                std::vector<std::string> needles = keywords;
+                if (opts.caseInsensitive) {
+                    for (char& c : haystack) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                    for (std::string& n : needles) {
+                        for (char& c : n) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                    }
+                }
+
+                std::vector<MultiPatternMatcher::Match> expected;
+                for (uint32_t id = 0; id < needles.size(); ++id) {
+                    for (size_t pos = haystack.find(needles[id]); pos != std::string::npos; pos = haystack.find(needles[id], pos + 1)) {
+                        expected.push_back({ pos, id });
+                    }
+                }
+                std::sort(expected.begin(), expected.end());
+                correct = matcher.findAll(text) == expected;
+
+                // Same text through the stream in random chunks
+                std::vector<MultiPatternMatcher::Match> streamed;
+                MultiPatternMatcher::Stream stream = matcher.stream();
+                for (size_t offset = 0; offset < text.size();) {
+                    size_t chunk = 1 + gen() % 7;
+                    stream.feed(std::string_view(text).substr(offset, chunk), [&](const MultiPatternMatcher::Match& m) { streamed.push_back(m); });
+                    offset += chunk;
+                }
+                std::sort(streamed.begin(), streamed.end());
+                correct = correct && streamed == expected;
+            }
+            std::cout << "  Random texts and keyword sets: " << (correct ? "OK" : "FAILED") << std::endl;
+            return correct;
+        }
+
+        static void compareThroughput(size_t bytes = 64 * 1024 * 1024) {
+            std::cout << "\n=== MULTI-PATTERN MATCHER: THROUGHPUT (" << bytes / (1024 * 1024) << " MB) ===" << std::endl;
+
+            std::mt19937 gen(2026);
+            std::string text = generateLog(bytes, gen);
+
+            std::vector<std::string> few;
+            for (int k = 0; k < 8; ++k) few.push_back(randomWord(gen, 6, 10));
+            runCase("small set", text, few);
+
+            std::vector<std::string> many;
+            for (int k = 0; k < 300; ++k) many.push_back(randomWord(gen, 4, 10));
+            runCase("large set", text, many);
+        }
+    };
+
+} // namespace MathLib
\ No newline at end of file
@@ -0,0 +1,638 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <span>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+
+class BatchInversions {
+public:
+    //  ,  MergeSort::mergeSortWithInversions,   
+    //        -   
+    static long long sortAndCount(vector<int>& values, vector<int>& buffer) {
+        size_t n = values.size();
+        buffer.resize(n);
+        long long inversions = 0;
+
+        for (size_t width = 1; width < n; width *= 2) {
+            for (size_t left = 0; left < n; left += 2 * width) {
+                size_t mid = min(n, left + width);
+                size_t right = min(n, left + 2 * width);
+                size_t i = left, j = mid, k = left;
+                while (i < mid && j < right) {
+                    if (values[i] <= values[j]) {
+                        buffer[k++] = values[i++];
+                    }
+                    else {
+                        buffer[k++] = values[j++];
+                        inversions += static_cast<long long>(mid - i);
+                    }
+                }
+                while (i < mid) buffer[k++] = values[i++];
+                while (j < right) buffer[k++] = values[j++];
+            }
+            values.swap(buffer);
+        }
+        return inversions;
+    }
+};
+
+// ====================      ====================
+//
+//       (,
+//       ).   -
+// O(log U),  U -  .
+
+class FenwickOrderStatistics {
+private:
+    vector<int> universe;      //   
+    vector<uint32_t> tree;     //  ,   1
+    vector<uint32_t> counts;   //    -  count   
+    size_t total = 0;
+    size_t highestBit = 0;     //    <= U -    kth
+    bool denseRange = false;   //  -    :  = value - first
+
+    //    < value
+    size_t lowerIndex(int value) const {
+        if (denseRange) {
+            long long offset = static_cast<long long>(value) - universe.front();
+            return static_cast<size_t>(clamp<long long>(offset, 0, static_cast<long long>(universe.size())));
+        }
+        return static_cast<size_t>(std::lower_bound(universe.begin(), universe.end(), value) - universe.begin());
+    }
+
+    //    <= value
+    size_t upperIndex(int value) const {
+        if (denseRange) {
+            long long offset = static_cast<long long>(value) - universe.front() + 1;
+            return static_cast<size_t>(clamp<long long>(offset, 0, static_cast<long long>(universe.size())));
+        }
+        return static_cast<size_t>(std::upper_bound(universe.begin(), universe.end(), value) - universe.begin());
+    }
+
+    bool inUniverse(size_t index, int value) const {
+        return index < universe.size() && universe[index] == value;
+    }
+
+    //    ; ,    
+    size_t indexOf(int value) const {
+        size_t index = lowerIndex(value);
+        if (!inUniverse(index, value)) {
+            throw out_of_range(" " + to_string(value) + "    ");
+        }
+        return index;
+    }
+
+    void add(size_t index, uint32_t delta) {
+        for (size_t i = index + 1; i <= universe.size(); i += i & (~i + 1)) {
+            tree[i] += delta;   // delta = UINT32_MAX   -1 (   2^32)
+        }
+    }
+
+    //    [0, index)
+    size_t prefix(size_t index) const {
+        size_t sum = 0;
+        for (size_t i = index; i > 0; i &= i - 1) {
+            sum += tree[i];
+        }
+        return sum;
+    }
+
+    //    counts  O(U)
+    void rebuild() {
+        tree.assign(universe.size() + 1, 0);
+        for (size_t i = 1; i <= universe.size(); i++) {
+            tree[i] += counts[i - 1];
+            size_t parent = i + (i & (~i + 1));
+            if (parent <= universe.size()) tree[parent] += tree[i];
+        }
+    }
+
+public:
+    explicit FenwickOrderStatistics(vector<int> values) : universe(move(values)) {
+        sort(universe.begin(), universe.end());
+        universe.erase(unique(universe.begin(), universe.end()), universe.end());
+        tree.assign(universe.size() + 1, 0);
+        counts.assign(universe.size(), 0);
+        highestBit = universe.empty() ? 0 : bit_floor(universe.size());
+        denseRange = !universe.empty()
+            && static_cast<long long>(universe.back()) - universe.front() + 1 == static_cast<long long>(universe.size());
+    }
+
+    void insert(int value) {
+        size_t index = indexOf(value);
+        counts[index]++;
+        add(index, 1);
+        total++;
+    }
+
+    //   ; false,   
+    bool erase(int value) {
+        size_t index = lowerIndex(value);
+        if (!inUniverse(index, value) || counts[index] == 0) return false;
+
+        counts[index]--;
+        add(index, UINT32_MAX);
+        total--;
+        return true;
+    }
+
+    //     .    (x, y), 
+    // x   y (     )  x > y.
+    //   -   ;  -   ,
+    //    counts       
+    //   O(U)  |batch| * log U .
+    long long insertBatch(span<const int> values) {
+        long long added = 0;
+        if (values.size() * bit_width(universe.size()) <= universe.size()) {
+            for (int value : values) {
+                added += static_cast<long long>(countGreater(value));
+                insert(value);
+            }
+            return added;
+        }
+
+        //    -     
+        vector<int> indexes(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            indexes[i] = static_cast<int>(indexOf(values[i]));
+        }
+        vector<int> buffer;
+        added += BatchInversions::sortAndCount(indexes, buffer);
+
+        //  (, ):    -    
+        size_t lessOrEqual = 0;
+        size_t next = 0;
+        for (size_t i = 0; i < universe.size() && next < indexes.size(); i++) {
+            lessOrEqual += counts[i];
+            while (next < indexes.size() && static_cast<size_t>(indexes[next]) == i) {
+                added += static_cast<long long>(total - lessOrEqual);
+                next++;
+            }
+        }
+
+        for (int index : indexes) counts[index]++;
+        rebuild();
+        total += indexes.size();
+        return added;
+    }
+
+    size_t count(int value) const {
+        size_t index = lowerIndex(value);
+        return inUniverse(index, value) ? counts[index] : 0;
+    }
+
+    //   < value (value     )
+    size_t rank(int value) const {
+        return prefix(lowerIndex(value));
+    }
+
+    size_t countLessOrEqual(int value) const {
+        return prefix(upperIndex(value));
+    }
+
+    size_t countGreater(int value) const {
+        return total - countLessOrEqual(value);
+    }
+
+    // k-    ( 0) -     O(log U)
+    int kth(size_t k) const {
+        if (k >= total) {
+            throw out_of_range("k    ");
+        }
+        size_t position = 0;
+        size_t remaining = k;
+        for (size_t step = highestBit; step > 0; step >>= 1) {
+            size_t next = position + step;
+            if (next <= universe.size() && tree[next] <= remaining) {
+                position = next;
+                remaining -= tree[next];
+            }
+        }
+        return universe[position];
+    }
+
+    size_t size() const { return total; }
+    bool empty() const { return total == 0; }
+    size_t universeSize() const { return universe.size(); }
+
+    size_t memoryBytes() const {
+        return universe.size() * sizeof(int) + tree.size() * sizeof(uint32_t) + counts.size() * sizeof(uint32_t);
+    }
+};
+
+// ====================     ====================
+//
+//  ,  : B-  2.  - 
+//   2 * BLOCK_SIZE ,  -     
+//     ( rank  kth).    -
+// O(log n + BLOCK_SIZE)   :    - memmove.
+
+class CountingBlockTree {
+public:
+    static constexpr size_t BLOCK_SIZE = 1024;
+
+private:
+    vector<vector<int>> blocks;
+    vector<int> blockMax;
+    vector<uint32_t> sizeTree;   //    ,   1
+    size_t total = 0;
+
+    void addSize(size_t block, uint32_t delta) {
+        for (size_t i = block + 1; i < sizeTree.size(); i += i & (~i + 1)) {
+            sizeTree[i] += delta;
+        }
+    }
+
+    size_t blocksBefore(size_t block) const {
+        size_t sum = 0;
+        for (size_t i = block; i > 0; i &= i - 1) {
+            sum += sizeTree[i];
+        }
+        return sum;
+    }
+
+    //    -    O( );
+    //     BLOCK_SIZE 
+    void rebuildRoot() {
+        sizeTree.assign(blocks.size() + 1, 0);
+        blockMax.resize(blocks.size());
+        for (size_t b = 0; b < blocks.size(); b++) {
+            blockMax[b] = blocks[b].back();
+            size_t i = b + 1;
+            sizeTree[i] += static_cast<uint32_t>(blocks[b].size());
+            size_t parent = i + (i & (~i + 1));
+            if (parent < sizeTree.size()) sizeTree[parent] += sizeTree[i];
+        }
+    }
+
+    //     >= value
+    size_t blockFor(int value) const {
+        return static_cast<size_t>(std::lower_bound(blockMax.begin(), blockMax.end(), value) - blockMax.begin());
+    }
+
+public:
+    CountingBlockTree() = default;
+
+    void insert(int value) {
+        if (blocks.empty()) {
+            blocks.push_back({ value });
+            total = 1;
+            rebuildRoot();
+            return;
+        }
+
+        //      
+        size_t b = min(blockFor(value), blocks.size() - 1);
+        vector<int>& block = blocks[b];
+        block.insert(std::upper_bound(block.begin(), block.end(), value), value);
+        blockMax[b] = block.back();
+        addSize(b, 1);
+        total++;
+
+        if (block.size() > 2 * BLOCK_SIZE) {
+            vector<int> upper(block.begin() + BLOCK_SIZE, block.end());
+            block.resize(BLOCK_SIZE);
+            blocks.insert(blocks.begin() + b + 1, move(upper));
+            rebuildRoot();
+        }
+    }
+
+    bool erase(int value) {
+        size_t b = blockFor(value);
+        if (b == blocks.size()) return false;
+
+        vector<int>& block = blocks[b];
+        auto it = std::lower_bound(block.begin(), block.end(), value);
+        if (it == block.end() || *it != value) return false;
+
+        block.erase(it);
+        total--;
+        if (block.empty()) {
+            blocks.erase(blocks.begin() + b);
+            rebuildRoot();
+        }
+        else {
+            blockMax[b] = block.back();
+            addSize(b, UINT32_MAX);
+        }
+        return true;
+    }
+
+    //     ;  -  
+    // FenwickOrderStatistics::insertBatch.     
+    //   O(n + k log k),    .
+    long long insertBatch(span<const int> values) {
+        long long added = 0;
+        if (values.size() * 4 < total) {
+            for (int value : values) {
+                added += static_cast<long long>(countGreater(value));
+                insert(value);
+            }
+            return added;
+        }
+
+        vector<int> sorted(values.begin(), values.end());
+        vector<int> buffer;
+        added += BatchInversions::sortAndCount(sorted, buffer);
+
+        vector<int> existing;
+        existing.reserve(total);
+        for (const vector<int>& block : blocks) existing.insert(existing.end(), block.begin(), block.end());
+
+        vector<int> merged;
+        merged.reserve(existing.size() + sorted.size());
+        size_t p = 0;
+        for (int value : sorted) {
+            while (p < existing.size() && existing[p] <= value) merged.push_back(existing[p++]);
+            added += static_cast<long long>(existing.size() - p);
+            merged.push_back(value);
+        }
+        merged.insert(merged.end(), existing.begin() + p, existing.end());
+
+        blocks.clear();
+        for (size_t i = 0; i < merged.size(); i += BLOCK_SIZE) {
+            blocks.emplace_back(merged.begin() + i, merged.begin() + min(merged.size(), i + BLOCK_SIZE));
+        }
+        total = merged.size();
+        rebuildRoot();
+        return added;
+    }
+
+    size_t count(int value) const {
+        return countLessOrEqual(value) - rank(value);
+    }
+
+    size_t rank(int value) const {
+        size_t b = blockFor(value);
+        if (b == blocks.size()) return total;
+        const vector<int>& block = blocks[b];
+        return blocksBefore(b) + static_cast<size_t>(std::lower_bound(block.begin(), block.end(), value) - block.begin());
+    }
+
+    size_t countLessOrEqual(int value) const {
+        size_t b = static_cast<size_t>(std::upper_bound(blockMax.begin(), blockMax.end(), value) - blockMax.begin());
+        if (b == blocks.size()) return total;
+        const vector<int>& block = blocks[b];
+        return blocksBefore(b) + static_cast<size_t>(std::upper_bound(block.begin(), block.end(), value) - block.begin());
+    }
+
+    size_t countGreater(int value) const {
+        return total - countLessOrEqual(value);
+    }
+
+    int kth(size_t k) const {
+        if (k >= total) {
+            throw out_of_range("k    ");
+        }
+        size_t position = 0;
+        size_t remaining = k;
+        for (size_t step = bit_floor(blocks.size()); step > 0; step >>= 1) {
+            size_t next = position + step;
+            if (next <= blocks.size() && sizeTree[next] <= remaining) {
+                position = next;
+                remaining -= sizeTree[next];
+            }
+        }
+        return blocks[position][remaining];
+    }
+
+    size_t size() const { return total; }
+    bool empty() const { return total == 0; }
+    size_t blockCount() const { return blocks.size(); }
+};
+
+// ====================    ====================
+//
+// - MergeSort::mergeSortWithInversions:  
+//     (, )   .
+//      windowSize .
+
+template<typename Structure>
+class StreamInversionCounter {
+private:
+    Structure values;
+    deque<int> window;          //   -    
+    size_t windowSize = 0;      // 0 -  
+    long long inversions = 0;
+    long long pushed = 0;
+
+    void evict() {
+        while (windowSize != 0 && window.size() > windowSize) {
+            int oldest = window.front();
+            window.pop_front();
+            values.erase(oldest);
+            // oldest    :    
+            inversions -= static_cast<long long>(values.rank(oldest));
+        }
+    }
+
+public:
+    explicit StreamInversionCounter(Structure structure, size_t window = 0)
+        : values(move(structure)), windowSize(window) {
+    }
+
+    void push(int value) {
+        //   :      
+        inversions += static_cast<long long>(values.countGreater(value));
+        values.insert(value);
+        pushed++;
+        if (windowSize != 0) {
+            window.push_back(value);
+            evict();
+        }
+    }
+
+    // :    ,   
+    void pushBatch(span<const int> batch) {
+        if (windowSize != 0 && batch.size() > windowSize) {
+            for (int value : batch) push(value);
+            return;
+        }
+
+        inversions += values.insertBatch(batch);
+        pushed += static_cast<long long>(batch.size());
+        if (windowSize != 0) {
+            window.insert(window.end(), batch.begin(), batch.end());
+            evict();
+        }
+    }
+
+    long long getInversions() const { return inversions; }
+    long long getPushed() const { return pushed; }
+    const Structure& getValues() const { return values; }
+
+    //        : 0 - , 1 -  
+    double disorder() const {
+        double n = static_cast<double>(values.size());
+        return n < 2 ? 0.0 : static_cast<double>(inversions) / (n * (n - 1) / 2);
+    }
+};
+
+// ====================  ====================
+
+class OrderStatisticsBenchmark {
+private:
+    template<typename Structure>
+    static bool checkAgainstSorted(const Structure& structure, vector<int> reference, mt19937& gen) {
+        sort(reference.begin(), reference.end());
+        if (structure.size() != reference.size()) return false;
+        if (reference.empty()) return true;
+
+        uniform_int_distribution<size_t> pickIndex(0, reference.size() - 1);
+        for (int q = 0; q < 200; q++) {
+            size_t k = pickIndex(gen);
+            int value = reference[k];
+            size_t expectedRank = static_cast<size_t>(std::lower_bound(reference.begin(), reference.end(), value) - reference.begin());
+            size_t expectedUpper = static_cast<size_t>(std::upper_bound(reference.begin(), reference.end(), value) - reference.begin());
+            if (structure.kth(k) != value || structure.rank(value) != expectedRank
+                || structure.countLessOrEqual(value) != expectedUpper || structure.count(value) != expectedUpper - expectedRank) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    //         mergeSortWithInversions
+    static bool verify() {
+        cout << "\n===    ===" << endl;
+
+        mt19937 gen(35);
+        bool correct = true;
+        for (int test = 0; test < 60 && correct; test++) {
+            int range = test % 3 == 0 ? 20 : 5000;
+            //      -    value - first
+            int scale = test % 4 == 3 ? 3 : 1;
+            uniform_int_distribution<int> dis(-range, range);
+            auto draw = [&]() { return dis(gen) * scale; };
+            vector<int> universe;
+            for (int v = -range; v <= range; v++) universe.push_back(v * scale);
+
+            FenwickOrderStatistics fenwick(universe);
+            CountingBlockTree blockTree;
+            vector<int> reference;
+            int operations = 200 + test * 100;
+            for (int op = 0; op < operations; op++) {
+                int value = draw();
+                if (gen() % 4 == 0 && !reference.empty()) {
+                    value = reference[gen() % reference.size()];
+                    reference.erase(find(reference.begin(), reference.end(), value));
+                    correct = correct && fenwick.erase(value) && blockTree.erase(value);
+                }
+                else if (test % 2 == 0) {
+                    reference.push_back(value);
+                    fenwick.insert(value);
+                    blockTree.insert(value);
+                }
+                else {
+                    //   
+                    vector<int> batch(1 + gen() % 50);
+                    for (int& v : batch) v = draw();
+                    reference.insert(reference.end(), batch.begin(), batch.end());
+                    fenwick.insertBatch(batch);
+                    blockTree.insertBatch(batch);
+                }
+            }
+            correct = correct && checkAgainstSorted(fenwick, reference, gen) && checkAgainstSorted(blockTree, reference, gen);
+
+            // : ,    
+            vector<int> stream(2000 + test * 50);
+            for (int& v : stream) v = draw();
+            vector<int> copy = stream;
+            long long expected = MergeSort::mergeSortWithInversions(copy, 0, static_cast<int>(copy.size()) - 1);
+
+            StreamInversionCounter<FenwickOrderStatistics> single{ FenwickOrderStatistics(universe) };
+            StreamInversionCounter<CountingBlockTree> batched{ CountingBlockTree() };
+            for (int v : stream) single.push(v);
+            for (size_t i = 0; i < stream.size(); i += 97) {
+                batched.pushBatch(span<const int>(stream).subspan(i, min<size_t>(97, stream.size() - i)));
+            }
+            correct = correct && single.getInversions() == expected && batched.getInversions() == expected;
+
+            size_t windowSize = 100 + test;
+            StreamInversionCounter<CountingBlockTree> windowed(CountingBlockTree(), windowSize);
+            for (int v : stream) windowed.push(v);
+            vector<int> tail(stream.end() - windowSize, stream.end());
+            correct = correct && windowed.getInversions() == MergeSort::mergeSortWithInversions(tail, 0, static_cast<int>(tail.size()) - 1);
+        }
+        cout << "  insert/erase/rank/kth  : " << (correct ? "OK" : "") << endl;
+        return correct;
+    }
+
+    static void compareStreaming(long long total = 100000000) {
+        cout << "\n===     " << total << "  ===" << endl;
+
+        mt19937 gen(2026);
+        const int universeSize = 1 << 24;
+        vector<int> universe(universeSize);
+        for (int i = 0; i < universeSize; i++) universe[i] = i;
+        uniform_int_distribution<int> dis(0, universeSize - 1);
+
+        //   : -   mergeSortWithInversions
+        vector<int> prefix(1000000);
+        mt19937 prefixGen(2026);
+        for (int& v : prefix) v = dis(prefixGen);
+        vector<int> prefixCopy = prefix;
+        auto start = high_resolution_clock::now();
+        long long expected = MergeSort::mergeSortWithInversions(prefixCopy, 0, static_cast<int>(prefixCopy.size()) - 1);
+        auto end = high_resolution_clock::now();
+        cout << "  mergeSortWithInversions (10^6, ): " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        // 
+        StreamInversionCounter<FenwickOrderStatistics> single{ FenwickOrderStatistics(universe) };
+        bool prefixOk = false;
+        start = high_resolution_clock::now();
+        for (long long i = 0; i < total; i++) {
+            single.push(dis(gen));
+            if (i + 1 == static_cast<long long>(prefix.size())) prefixOk = single.getInversions() == expected;
+        }
+        end = high_resolution_clock::now();
+        double singleNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(total);
+        cout << "  ,  : " << singleNs << " /,  " << single.getInversions()
+            << ",  " << single.disorder() << " ( " << (prefixOk ? "OK" : "") << ")" << endl;
+
+        //    :        
+        gen.seed(2026);
+        StreamInversionCounter<FenwickOrderStatistics> batched{ FenwickOrderStatistics(universe) };
+        vector<int> batch(universeSize);
+        start = high_resolution_clock::now();
+        for (long long i = 0; i < total; i += static_cast<long long>(batch.size())) {
+            size_t take = static_cast<size_t>(min<long long>(static_cast<long long>(batch.size()), total - i));
+            for (size_t j = 0; j < take; j++) batch[j] = dis(gen);
+            batched.pushBatch(span<const int>(batch.data(), take));
+        }
+        end = high_resolution_clock::now();
+        double batchNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(total);
+        cout << "  ,   2^24: " << batchNs << " / ("
+            << (batched.getInversions() == single.getInversions() ? "OK" : "") << ")" << endl;
+
+        //       ,  10^6
+        const size_t windowSize = 1000000;
+        StreamInversionCounter<CountingBlockTree> windowed(CountingBlockTree(), windowSize);
+        normal_distribution<double> delay(0.0, 50.0);
+        start = high_resolution_clock::now();
+        for (long long i = 0; i < total; i++) {
+            int timestamp = static_cast<int>(i % 2000000000) + static_cast<int>(fabs(delay(gen)));
+            windowed.push(timestamp);
+        }
+        end = high_resolution_clock::now();
+        double windowNs = duration_cast<nanoseconds>(end - start).count() / static_cast<double>(total);
+        cout << "   ,  10^6,   : " << windowNs << " /,    "
+            << windowed.getInversions() << ",  " << windowed.disorder() << endl;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,688 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <bit>
+#include <cmath>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================     ====================
+
+enum class JobPriority { High = 0, Normal = 1, Low = 2 };
+
+//       . 
+//    :    
+// (, )   ,     
+// ,    ,    .
+template<typename T>
+class BoundedPriorityQueue {
+private:
+    static constexpr int LEVELS = 3;
+
+    mutable mutex lock;
+    condition_variable notEmpty;
+    condition_variable notFull;
+    deque<T> levels[LEVELS];
+    size_t count = 0;
+    size_t capacity;
+    bool closed = false;
+
+    void pushLocked(T&& item, JobPriority priority) {
+        levels[static_cast<int>(priority)].push_back(move(item));
+        count++;
+    }
+
+public:
+    explicit BoundedPriorityQueue(size_t maxSize) : capacity(maxSize) {
+        if (maxSize == 0) {
+            throw invalid_argument("    ");
+        }
+    }
+
+    // ,   ; false,   
+    bool push(T item, JobPriority priority) {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [&]() { return count < capacity || closed; });
+        if (closed) return false;
+        pushLocked(move(item), priority);
+        guard.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    //  : false,     
+    bool tryPush(T item, JobPriority priority) {
+        unique_lock<mutex> guard(lock);
+        if (closed || count >= capacity) return false;
+        pushLocked(move(item), priority);
+        guard.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    void pushUnbounded(T item, JobPriority priority) {
+        {
+            lock_guard<mutex> guard(lock);
+            pushLocked(move(item), priority);
+        }
+        notEmpty.notify_one();
+    }
+
+    //    ; nullopt -    .
+    //     - .
+    optional<T> pop() {
+        unique_lock<mutex> guard(lock);
+        notEmpty.wait(guard, [&]() { return count > 0 || closed; });
+        if (count == 0) return nullopt;
+
+        for (deque<T>& level : levels) {
+            if (level.empty()) continue;
+            T item = move(level.front());
+            level.pop_front();
+            count--;
+            guard.unlock();
+            notFull.notify_one();
+            return item;
+        }
+        return nullopt;
+    }
+
+    void close() {
+        {
+            lock_guard<mutex> guard(lock);
+            closed = true;
+        }
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+    size_t size() const {
+        lock_guard<mutex> guard(lock);
+        return count;
+    }
+};
+
+// ====================   ====================
+
+//    8     (  12.5%).
+//  -   ,  .
+class LatencyHistogram {
+private:
+    static constexpr int SUB_BUCKETS = 8;
+    static constexpr int BUCKETS = 16 + 60 * SUB_BUCKETS;
+
+    atomic<uint64_t> buckets[BUCKETS] = {};
+    atomic<uint64_t> samples{ 0 };
+    atomic<uint64_t> totalNs{ 0 };
+
+    static int bucketOf(uint64_t ns) {
+        if (ns < 16) return static_cast<int>(ns);
+        int exponent = static_cast<int>(bit_width(ns)) - 1;
+        int sub = static_cast<int>((ns >> (exponent - 3)) & (SUB_BUCKETS - 1));
+        return min(BUCKETS - 1, 16 + (exponent - 4) * SUB_BUCKETS + sub);
+    }
+
+    //   
+    static uint64_t bucketLimit(int bucket) {
+        if (bucket < 16) return static_cast<uint64_t>(bucket);
+        int exponent = (bucket - 16) / SUB_BUCKETS + 4;
+        uint64_t sub = static_cast<uint64_t>((bucket - 16) % SUB_BUCKETS);
+        return ((SUB_BUCKETS + sub + 1) << (exponent - 3)) - 1;
+    }
+
+public:
+    void record(nanoseconds value) {
+        uint64_t ns = static_cast<uint64_t>(max<long long>(0, value.count()));
+        buckets[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+        samples.fetch_add(1, memory_order_relaxed);
+        totalNs.fetch_add(ns, memory_order_relaxed);
+    }
+
+    uint64_t count() const { return samples.load(); }
+
+    double meanUs() const {
+        uint64_t n = samples.load();
+        return n == 0 ? 0.0 : static_cast<double>(totalNs.load()) / n / 1000.0;
+    }
+
+    // p  0  1
+    double percentileUs(double p) const {
+        uint64_t n = samples.load();
+        if (n == 0) return 0.0;
+        uint64_t target = static_cast<uint64_t>(ceil(p * static_cast<double>(n)));
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            seen += buckets[b].load(memory_order_relaxed);
+            if (seen >= max<uint64_t>(target, 1)) return bucketLimit(b) / 1000.0;
+        }
+        return bucketLimit(BUCKETS - 1) / 1000.0;
+    }
+};
+
+// ====================   ====================
+
+enum class SortAlgorithm { Std, Merge, QuickThreeWay };
+
+class JobCancelledError : public runtime_error {
+public:
+    JobCancelledError() : runtime_error(" ") {}
+};
+
+//   :     
+struct JobControl {
+    atomic<bool> cancelled{ false };
+    atomic<bool> finished{ false };
+    steady_clock::time_point submittedAt;
+    steady_clock::time_point startedAt;
+    steady_clock::time_point finishedAt;
+};
+
+template<typename T>
+class JobHandle {
+private:
+    future<T> result;
+    shared_ptr<JobControl> control;
+
+public:
+    JobHandle(future<T> f, shared_ptr<JobControl> c) : result(move(f)), control(move(c)) {}
+
+    //     :   .
+    // false -   
+    bool cancel() {
+        control->cancelled = true;
+        return !control->finished;
+    }
+
+    T get() { return result.get(); }
+    void wait() const { result.wait(); }
+    bool ready() const { return result.wait_for(nanoseconds(0)) == future_status::ready; }
+
+    //   -      
+    steady_clock::time_point finishedAt() const { return control->finishedAt; }
+    steady_clock::time_point submittedAt() const { return control->submittedAt; }
+};
+
+class SortService {
+public:
+    struct Options {
+        unsigned workers = 0;                  // 0 -   
+        size_t queueCapacity = 1024;           //    
+        size_t parallelThreshold = 1 << 18;    //       
+        size_t minChunk = 1 << 16;
+    };
+
+    struct Metrics {
+        size_t queueDepth = 0;
+        size_t maxQueueDepth = 0;
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        uint64_t cancelled = 0;
+        uint64_t failed = 0;
+        double waitP50Us = 0, waitP99Us = 0, waitMeanUs = 0;         //      
+        double serviceP50Us = 0, serviceP99Us = 0, serviceMeanUs = 0; //    
+    };
+
+private:
+    struct Task {
+        function<void()> body;
+        steady_clock::time_point enqueuedAt;
+        shared_ptr<JobControl> control;   //  null     
+    };
+
+    Options options;
+    BoundedPriorityQueue<Task> queue;
+    vector<thread> workers;
+
+    atomic<size_t> maxDepth{ 0 };
+    atomic<uint64_t> submitted{ 0 };
+    atomic<uint64_t> completed{ 0 };
+    atomic<uint64_t> cancelled{ 0 };
+    atomic<uint64_t> failed{ 0 };
+    LatencyHistogram waitTime;
+    LatencyHistogram serviceTime;
+
+    void workerLoop() {
+        while (optional<Task> task = queue.pop()) {
+            if (task->control) {
+                task->control->startedAt = steady_clock::now();
+                waitTime.record(task->control->startedAt - task->enqueuedAt);
+            }
+            task->body();
+        }
+    }
+
+    template<typename T>
+    void complete(promise<T>& result, const shared_ptr<JobControl>& control, T value) {
+        control->finishedAt = steady_clock::now();
+        control->finished = true;
+        serviceTime.record(control->finishedAt - control->startedAt);
+        completed++;
+        result.set_value(move(value));
+    }
+
+    template<typename T>
+    void fail(promise<T>& result, const shared_ptr<JobControl>& control, exception_ptr error) {
+        control->finishedAt = steady_clock::now();
+        control->finished = true;
+        (control->cancelled ? cancelled : failed)++;
+        result.set_exception(error);
+    }
+
+    //      (   )
+    void submitTask(function<void()> body, JobPriority priority, const shared_ptr<JobControl>& control) {
+        control->submittedAt = steady_clock::now();
+        submitted++;
+        if (!queue.push(Task{ move(body), control->submittedAt, control }, priority)) {
+            throw runtime_error(" ");
+        }
+        size_t depth = queue.size();
+        size_t seen = maxDepth.load();
+        while (depth > seen && !maxDepth.compare_exchange_weak(seen, depth)) {}
+    }
+
+    //    :     
+    struct ForkState {
+        atomic<size_t> pending;
+        atomic<bool> failed{ false };
+        exception_ptr error;
+
+        explicit ForkState(size_t count) : pending(count) {}
+    };
+
+    //  count -; done    
+    //       body ( nullptr). 
+    //        .
+    void forkChunks(size_t count, JobPriority priority, const shared_ptr<JobControl>& control,
+        function<void(size_t)> body, function<void(exception_ptr)> done) {
+        auto state = make_shared<ForkState>(count);
+        auto sharedBody = make_shared<function<void(size_t)>>(move(body));
+        auto sharedDone = make_shared<function<void(exception_ptr)>>(move(done));
+        for (size_t c = 0; c < count; c++) {
+            queue.pushUnbounded(Task{ [=]() {
+                if (!control->cancelled && !state->failed) {
+                    try {
+                        (*sharedBody)(c);
+                    }
+                    catch (...) {
+                        if (!state->failed.exchange(true)) state->error = current_exception();
+                    }
+                }
+                if (state->pending.fetch_sub(1) == 1) (*sharedDone)(state->error);
+                }, steady_clock::now(), nullptr }, priority);
+        }
+    }
+
+    static void sortRange(vector<int>& data, int low, int high, SortAlgorithm algorithm) {
+        switch (algorithm) {
+        case SortAlgorithm::Merge:
+            MergeSort::mergeSort(data, low, high);
+            break;
+        case SortAlgorithm::QuickThreeWay:
+            QuickSort::quickSortThreeWay(data, low, high);
+            break;
+        default:
+            sort(data.begin() + low, data.begin() + high + 1);
+            break;
+        }
+    }
+
+    size_t chunkCount(size_t n) const {
+        if (workers.size() <= 1 || n < options.parallelThreshold) return 1;
+        size_t chunks = min<size_t>(workers.size(), n / options.minChunk);
+        return max<size_t>(1, bit_floor(chunks));   //   -  
+    }
+
+    //   :   ,
+    //    ,   -  
+    struct ChunkedSort {
+        vector<int> data;
+        vector<int> buffer;
+        vector<size_t> bounds;
+        SortAlgorithm algorithm;
+        JobPriority priority;
+        shared_ptr<JobControl> control;
+        promise<vector<int>> result;
+    };
+
+    void mergeRound(shared_ptr<ChunkedSort> job, size_t width) {
+        size_t chunks = job->bounds.size() - 1;
+        if (job->control->cancelled) {
+            fail(job->result, job->control, make_exception_ptr(JobCancelledError()));
+            return;
+        }
+        if (width >= chunks) {
+            complete(job->result, job->control, move(job->data));
+            return;
+        }
+
+        forkChunks(chunks / (2 * width), job->priority, job->control,
+            [job, width](size_t pair) {
+                size_t first = job->bounds[pair * 2 * width];
+                size_t middle = job->bounds[pair * 2 * width + width];
+                size_t last = job->bounds[pair * 2 * width + 2 * width];
+                merge(job->data.begin() + first, job->data.begin() + middle,
+                    job->data.begin() + middle, job->data.begin() + last, job->buffer.begin() + first);
+            },
+            [this, job, width](exception_ptr error) {
+                if (error) {
+                    fail(job->result, job->control, error);
+                    return;
+                }
+                job->data.swap(job->buffer);
+                mergeRound(job, width * 2);
+            });
+    }
+
+public:
+    SortService() : SortService(Options()) {}
+
+    explicit SortService(const Options& opts) : options(opts), queue(opts.queueCapacity) {
+        unsigned count = options.workers != 0 ? options.workers : max(1u, thread::hardware_concurrency());
+        for (unsigned i = 0; i < count; i++) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~SortService() {
+        shutdown();
+    }
+
+    SortService(const SortService&) = delete;
+    SortService& operator=(const SortService&) = delete;
+
+    //    ;   
+    void shutdown() {
+        queue.close();
+        for (thread& worker : workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    JobHandle<vector<int>> submitSort(vector<int> data, SortAlgorithm algorithm = SortAlgorithm::Std,
+        JobPriority priority = JobPriority::Normal) {
+        if (data.size() > static_cast<size_t>(INT_MAX)) {
+            throw invalid_argument("     ");
+        }
+
+        auto job = make_shared<ChunkedSort>();
+        job->data = move(data);
+        job->algorithm = algorithm;
+        job->priority = priority;
+        job->control = make_shared<JobControl>();
+        future<vector<int>> result = job->result.get_future();
+
+        submitTask([this, job]() {
+            if (job->control->cancelled) {
+                fail(job->result, job->control, make_exception_ptr(JobCancelledError()));
+                return;
+            }
+            try {
+                size_t n = job->data.size();
+                size_t chunks = chunkCount(n);
+                if (chunks == 1) {
+                    if (n > 1) sortRange(job->data, 0, static_cast<int>(n) - 1, job->algorithm);
+                    complete(job->result, job->control, move(job->data));
+                    return;
+                }
+
+                job->buffer.resize(n);
+                for (size_t c = 0; c <= chunks; c++) job->bounds.push_back(n * c / chunks);
+                forkChunks(chunks, job->priority, job->control,
+                    [job](size_t c) {
+                        sortRange(job->data, static_cast<int>(job->bounds[c]), static_cast<int>(job->bounds[c + 1]) - 1, job->algorithm);
+                    },
+                    [this, job](exception_ptr error) {
+                        if (error) fail(job->result, job->control, error);
+                        else mergeRound(job, 1);
+                    });
+            }
+            catch (...) {
+                fail(job->result, job->control, current_exception());
+            }
+            }, priority, job->control);
+
+        return JobHandle<vector<int>>(move(result), job->control);
+    }
+
+    //       :  
+    //  BinarySearchAlgorithms::binarySearchIterative (-1 -  )
+    JobHandle<vector<int>> submitSearch(shared_ptr<const vector<int>> sorted, vector<int> queries,
+        JobPriority priority = JobPriority::Normal) {
+        struct SearchJob {
+            shared_ptr<const vector<int>> sorted;
+            vector<int> queries;
+            vector<int> positions;
+            shared_ptr<JobControl> control = make_shared<JobControl>();
+            promise<vector<int>> result;
+        };
+
+        auto job = make_shared<SearchJob>();
+        job->sorted = move(sorted);
+        job->queries = move(queries);
+        job->positions.resize(job->queries.size());
+        future<vector<int>> result = job->result.get_future();
+
+        auto searchRange = [job](size_t from, size_t to) {
+            for (size_t i = from; i < to; i++) {
+                job->positions[i] = BinarySearchAlgorithms::binarySearchIterative(*job->sorted, job->queries[i]);
+            }
+        };
+
+        submitTask([this, job, searchRange, priority]() {
+            if (job->control->cancelled) {
+                fail(job->result, job->control, make_exception_ptr(JobCancelledError()));
+                return;
+            }
+            size_t n = job->queries.size();
+            //         
+            size_t chunks = chunkCount(n * 64);
+            if (chunks == 1) {
+                searchRange(0, n);
+                complete(job->result, job->control, move(job->positions));
+                return;
+            }
+            forkChunks(chunks, priority, job->control,
+                [job, searchRange, chunks](size_t c) {
+                    size_t n = job->queries.size();
+                    searchRange(n * c / chunks, n * (c + 1) / chunks);
+                },
+                [this, job](exception_ptr error) {
+                    if (error) {
+                        fail(job->result, job->control, error);
+                    }
+                    else if (job->control->cancelled) {
+                        fail(job->result, job->control, make_exception_ptr(JobCancelledError()));
+                    }
+                    else {
+                        complete(job->result, job->control, move(job->positions));
+                    }
+                });
+            }, priority, job->control);
+
+        return JobHandle<vector<int>>(move(result), job->control);
+    }
+
+    size_t workerCount() const { return workers.size(); }
+
+    Metrics getMetrics() const {
+        Metrics m;
+        m.queueDepth = queue.size();
+        m.maxQueueDepth = maxDepth.load();
+        m.submitted = submitted.load();
+        m.completed = completed.load();
+        m.cancelled = cancelled.load();
+        m.failed = failed.load();
+        m.waitP50Us = waitTime.percentileUs(0.5);
+        m.waitP99Us = waitTime.percentileUs(0.99);
+        m.waitMeanUs = waitTime.meanUs();
+        m.serviceP50Us = serviceTime.percentileUs(0.5);
+        m.serviceP99Us = serviceTime.percentileUs(0.99);
+        m.serviceMeanUs = serviceTime.meanUs();
+        return m;
+    }
+};
+
+// ====================   ====================
+
+class SortServiceBenchmark {
+private:
+    static vector<int> randomArray(size_t size, mt19937& gen) {
+        uniform_int_distribution<int> dis(1, 1000000);
+        vector<int> arr(size);
+        for (int& v : arr) v = dis(gen);
+        return arr;
+    }
+
+    static double percentile(vector<double> values, double p) {
+        if (values.empty()) return 0.0;
+        sort(values.begin(), values.end());
+        size_t index = min(values.size() - 1, static_cast<size_t>(ceil(p * values.size())) - (p > 0 ? 1 : 0));
+        return values[index];
+    }
+
+    static void printLatencies(const string& title, const vector<double>& latenciesUs) {
+        cout << "  " << title << ": p50 " << percentile(latenciesUs, 0.5) << " , p99 "
+            << percentile(latenciesUs, 0.99) << " , max " << percentile(latenciesUs, 1.0) << " " << endl;
+    }
+
+public:
+    static bool verify() {
+        cout << "\n===    ===" << endl;
+
+        SortService::Options options;
+        options.workers = 4;
+        options.parallelThreshold = 1000;
+        options.minChunk = 100;
+        SortService service(options);
+
+        mt19937 gen(36);
+        bool correct = true;
+        vector<pair<vector<int>, JobHandle<vector<int>>>> jobs;
+        for (int i = 0; i < 60; i++) {
+            vector<int> data(gen() % 20000);
+            uniform_int_distribution<int> dis(0, i % 2 ? 100 : 1000000);
+            for (int& v : data) v = dis(gen);
+            SortAlgorithm algorithm = static_cast<SortAlgorithm>(i % 3);
+            JobPriority priority = static_cast<JobPriority>(i % 3);
+            jobs.emplace_back(data, service.submitSort(data, algorithm, priority));
+        }
+        for (auto& [data, handle] : jobs) {
+            sort(data.begin(), data.end());
+            correct = correct && handle.get() == data;
+        }
+        cout << "   ( + ,  ): " << (correct ? "OK" : "") << endl;
+
+        auto sorted = make_shared<vector<int>>(randomArray(50000, gen));
+        sort(sorted->begin(), sorted->end());
+        vector<int> queries(100000);
+        for (int& q : queries) q = static_cast<int>(gen() % 1000000);
+        vector<int> positions = service.submitSearch(sorted, queries).get();
+        bool searchOk = true;
+        for (size_t i = 0; i < queries.size(); i++) {
+            int expected = BinarySearchAlgorithms::binarySearchIterative(*sorted, queries[i]);
+            searchOk = searchOk && positions[i] == expected;
+        }
+        cout << "  : " << (searchOk ? "OK" : "") << endl;
+
+        // :      
+        JobHandle<vector<int>> big = service.submitSort(randomArray(2000000, gen), SortAlgorithm::Merge);
+        big.cancel();
+        bool cancelOk = false;
+        try {
+            big.get();
+        }
+        catch (const JobCancelledError&) {
+            cancelOk = true;
+        }
+        cout << "  : " << (cancelOk ? "OK" : "  ") << endl;
+        return correct && searchOk;
+    }
+
+    //  :      
+    // ,      
+    static void loadTest(double requestsPerSecond = 1000, int durationMs = 3000, int jobSize = 10000) {
+        cout << "\n===  : " << requestsPerSecond << " /,  " << jobSize
+            << " , " << durationMs << "  ===" << endl;
+
+        //   ,      
+        mt19937 gen(2026);
+        vector<vector<int>> inputs;
+        for (int i = 0; i < 64; i++) inputs.push_back(randomArray(jobSize, gen));
+
+        size_t total = static_cast<size_t>(requestsPerSecond * durationMs / 1000.0);
+        nanoseconds interval(static_cast<long long>(1e9 / requestsPerSecond));
+
+        // 
+        {
+            SortService service;
+            vector<JobHandle<vector<int>>> handles;
+            vector<steady_clock::time_point> scheduled;
+            handles.reserve(total);
+
+            auto start = steady_clock::now();
+            for (size_t i = 0; i < total; i++) {
+                auto due = start + interval * static_cast<long long>(i);
+                this_thread::sleep_until(due);
+                scheduled.push_back(due);
+                //  :    - 
+                JobPriority priority = i % 10 == 0 ? JobPriority::High : JobPriority::Normal;
+                handles.push_back(service.submitSort(inputs[i % inputs.size()], SortAlgorithm::Std, priority));
+            }
+
+            vector<double> all, high;
+            for (size_t i = 0; i < handles.size(); i++) {
+                handles[i].wait();
+                double us = duration_cast<nanoseconds>(handles[i].finishedAt() - scheduled[i]).count() / 1000.0;
+                all.push_back(us);
+                if (i % 10 == 0) high.push_back(us);
+            }
+
+            SortService::Metrics m = service.getMetrics();
+            cout << "   (" << service.workerCount() << " ):" << endl;
+            printLatencies("   ", all);
+            printLatencies("   High", high);
+            cout << "    : max " << m.maxQueueDepth << ";  p50 " << m.waitP50Us << " / p99 " << m.waitP99Us
+                << " ;  p50 " << m.serviceP50Us << " / p99 " << m.serviceP99Us << " ;  "
+                << m.completed << "  " << m.submitted << endl;
+        }
+
+        //  :   -  ,  
+        {
+            vector<thread> threads;
+            vector<double> latencies(total);
+            auto start = steady_clock::now();
+            for (size_t i = 0; i < total; i++) {
+                auto due = start + interval * static_cast<long long>(i);
+                this_thread::sleep_until(due);
+                threads.emplace_back([&inputs, &latencies, i, due]() {
+                    vector<int> data = inputs[i % inputs.size()];
+                    sort(data.begin(), data.end());
+                    latencies[i] = duration_cast<nanoseconds>(steady_clock::now() - due).count() / 1000.0;
+                    });
+            }
+            for (thread& t : threads) t.join();
+            cout << "    :" << endl;
+            printLatencies("   ", latencies);
+        }
+    }
+};
\ No newline at end of file
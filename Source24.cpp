@@ -0,0 +1,849 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <tuple>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <stdexcept>
+
+// _popen/_pclose  Windows   <cstdio>, getenv -  <cstdlib>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "Source12.cpp"
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+
+// ,    : ,      .
+//          
+struct BenchmarkEnvironment {
+    string machine;        //   
+    string machineInfo;    // , ,  , 
+    string compiler;
+    string flags;
+    string revision;
+
+    static BenchmarkEnvironment detect() {
+        BenchmarkEnvironment env;
+        env.machineInfo = hostName() + "; " + cpuModel() + "; " +
+            to_string(thread::hardware_concurrency()) + " ; " + osName();
+        env.machine = hashHex(env.machineInfo);
+        env.compiler = compilerName();
+        env.flags = compilerFlags();
+        env.revision = gitRevision();
+        return env;
+    }
+
+    //     :     
+    string configurationKey() const {
+        return machine + "|" + compiler + "|" + flags;
+    }
+
+private:
+    static string hashHex(const string& text) {
+        uint64_t hash = 1469598103934665603ULL;  // FNV-1a
+        for (unsigned char c : text) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        char buffer[17];
+        snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+        return buffer;
+    }
+
+    static string hostName() {
+#ifdef _WIN32
+        const char* name = getenv("COMPUTERNAME");
+        return name ? name : "unknown";
+#else
+        char buffer[256] = {};
+        if (gethostname(buffer, sizeof(buffer) - 1) != 0) return "unknown";
+        return buffer;
+#endif
+    }
+
+    static string cpuModel() {
+#ifdef _WIN32
+        const char* id = getenv("PROCESSOR_IDENTIFIER");
+        return id ? id : "unknown cpu";
+#else
+        ifstream cpuinfo("/proc/cpuinfo");
+        string line;
+        while (getline(cpuinfo, line)) {
+            if (line.compare(0, 10, "model name") == 0) {
+                size_t colon = line.find(':');
+                if (colon != string::npos) {
+                    size_t start = line.find_first_not_of(' ', colon + 1);
+                    return start == string::npos ? "unknown cpu" : line.substr(start);
+                }
+            }
+        }
+        return "unknown cpu";
+#endif
+    }
+
+    static string osName() {
+#if defined(_WIN32)
+        return "windows";
+#elif defined(__APPLE__)
+        return "macos";
+#elif defined(__linux__)
+        return "linux";
+#else
+        return "unknown os";
+#endif
+    }
+
+    static string compilerName() {
+#if defined(__clang__)
+        return string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        return string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + to_string(_MSC_FULL_VER);
+#else
+        return "unknown compiler";
+#endif
+    }
+
+    //      ,   
+    //     -DBENCH_COMPILER_FLAGS="\"...\"".  
+    //    
+    static string compilerFlags() {
+        string flags;
+#ifdef BENCH_COMPILER_FLAGS
+        flags = BENCH_COMPILER_FLAGS;
+        flags += " ";
+#endif
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+        flags += "opt";
+#else
+        flags += "noopt";
+#endif
+#ifdef NDEBUG
+        flags += " ndebug";
+#endif
+#if defined(__AVX512F__)
+        flags += " avx512";
+#elif defined(__AVX2__)
+        flags += " avx2";
+#elif defined(__AVX__)
+        flags += " avx";
+#elif defined(__SSE4_2__)
+        flags += " sse4.2";
+#endif
+#ifdef _MSVC_LANG
+        flags += " c++" + to_string(_MSVC_LANG);
+#else
+        flags += " c++" + to_string(__cplusplus);
+#endif
+        return flags;
+    }
+
+    static string runCommand(const string& command, int& status) {
+#ifdef _WIN32
+        FILE* pipe = _popen(command.c_str(), "r");
+#else
+        FILE* pipe = popen(command.c_str(), "r");
+#endif
+        if (!pipe) {
+            status = -1;
+            return "";
+        }
+        string output;
+        char buffer[256];
+        while (fgets(buffer, sizeof(buffer), pipe)) {
+            output += buffer;
+        }
+#ifdef _WIN32
+        status = _pclose(pipe);
+#else
+        status = pclose(pipe);
+#endif
+        while (!output.empty() && (output.back() == '\n' || output.back() == '\r')) {
+            output.pop_back();
+        }
+        return output;
+    }
+
+    //      BENCH_GIT_REVISION (,  CI);
+    //     -dirty
+    static string gitRevision() {
+        if (const char* fromEnv = getenv("BENCH_GIT_REVISION")) {
+            return fromEnv;
+        }
+#ifdef _WIN32
+        const string quiet = " 2>nul";
+#else
+        const string quiet = " 2>/dev/null";
+#endif
+        int status = 0;
+        string revision = runCommand("git rev-parse --short=12 HEAD" + quiet, status);
+        if (status != 0 || revision.empty()) return "unknown";
+        string changes = runCommand("git status --porcelain --untracked-files=no" + quiet, status);
+        if (status == 0 && !changes.empty()) revision += "-dirty";
+        return revision;
+    }
+};
+
+// ====================    ====================
+
+//   :       
+struct BenchmarkRecord {
+    string runId;
+    long long timestamp = 0;    //  Unix
+    BenchmarkEnvironment environment;
+    string benchmark;           // , compareSortingAlgorithms
+    string caseName;            // 
+    string shape;               //  :    
+    vector<double> samples;     // 
+
+    // ,      
+    string caseKey() const {
+        return benchmark + " / " + caseName + " / " + shape;
+    }
+};
+
+// ====================   ====================
+
+//   :   -      .
+//    ,     
+// ,        
+class BenchmarkResultStore {
+public:
+    static constexpr const char* FORMAT_TAG = "BENCH1";
+    static constexpr size_t FIELD_COUNT = 12;
+
+    explicit BenchmarkResultStore(string path) : path(move(path)) {
+        if (this->path.empty()) {
+            throw invalid_argument("     ");
+        }
+    }
+
+    const string& getPath() const {
+        return path;
+    }
+
+    void append(const vector<BenchmarkRecord>& records) const {
+        ofstream out(path, ios::binary | ios::app);
+        if (!out) {
+            throw runtime_error("    : " + path);
+        }
+        for (const BenchmarkRecord& record : records) {
+            string line = serialize(record);
+            out.write(line.data(), (streamsize)line.size());
+        }
+        out.flush();
+        if (!out) {
+            throw runtime_error("    : " + path);
+        }
+    }
+
+    //   -  
+    vector<BenchmarkRecord> load() const {
+        vector<BenchmarkRecord> records;
+        ifstream in(path, ios::binary);
+        string line;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            BenchmarkRecord record;
+            if (parse(line, record)) {
+                records.push_back(move(record));
+            }
+        }
+        return records;
+    }
+
+    //     
+    static vector<string> runIds(const vector<BenchmarkRecord>& records) {
+        vector<string> ids;
+        for (const BenchmarkRecord& record : records) {
+            if (find(ids.begin(), ids.end(), record.runId) == ids.end()) {
+                ids.push_back(record.runId);
+            }
+        }
+        return ids;
+    }
+
+    static vector<BenchmarkRecord> selectRun(const vector<BenchmarkRecord>& records,
+        const string& runId) {
+        vector<BenchmarkRecord> selected;
+        for (const BenchmarkRecord& record : records) {
+            if (record.runId == runId) selected.push_back(record);
+        }
+        return selected;
+    }
+
+private:
+    string path;
+
+    static string escape(const string& field) {
+        string result;
+        result.reserve(field.size());
+        for (char c : field) {
+            switch (c) {
+            case '\\': result += "\\\\"; break;
+            case '\t': result += "\\t"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            default: result += c;
+            }
+        }
+        return result;
+    }
+
+    static string unescape(const string& field) {
+        string result;
+        result.reserve(field.size());
+        for (size_t i = 0; i < field.size(); i++) {
+            if (field[i] != '\\' || i + 1 == field.size()) {
+                result += field[i];
+                continue;
+            }
+            char next = field[++i];
+            result += next == 't' ? '\t' : next == 'n' ? '\n' : next == 'r' ? '\r' : next;
+        }
+        return result;
+    }
+
+    static string serialize(const BenchmarkRecord& record) {
+        const BenchmarkEnvironment& env = record.environment;
+        string samples;
+        char buffer[32];
+        for (size_t i = 0; i < record.samples.size(); i++) {
+            snprintf(buffer, sizeof(buffer), "%.17g", record.samples[i]);
+            if (i > 0) samples += ',';
+            samples += buffer;
+        }
+        const string fields[FIELD_COUNT] = {
+            FORMAT_TAG, record.runId, to_string(record.timestamp),
+            env.machine, env.machineInfo, env.compiler, env.flags, env.revision,
+            record.benchmark, record.caseName, record.shape, samples
+        };
+        string line;
+        for (size_t i = 0; i < FIELD_COUNT; i++) {
+            if (i > 0) line += '\t';
+            line += escape(fields[i]);
+        }
+        line += '\n';
+        return line;
+    }
+
+    static bool parse(const string& line, BenchmarkRecord& record) {
+        vector<string> fields;
+        size_t start = 0;
+        while (true) {
+            size_t tab = line.find('\t', start);
+            fields.push_back(unescape(line.substr(start, tab == string::npos ? string::npos : tab - start)));
+            if (tab == string::npos) break;
+            start = tab + 1;
+        }
+        if (fields.size() != FIELD_COUNT || fields[0] != FORMAT_TAG) return false;
+
+        try {
+            record.runId = fields[1];
+            record.timestamp = stoll(fields[2]);
+            record.environment.machine = fields[3];
+            record.environment.machineInfo = fields[4];
+            record.environment.compiler = fields[5];
+            record.environment.flags = fields[6];
+            record.environment.revision = fields[7];
+            record.benchmark = fields[8];
+            record.caseName = fields[9];
+            record.shape = fields[10];
+            stringstream samples(fields[11]);
+            string value;
+            while (getline(samples, value, ',')) {
+                record.samples.push_back(stod(value));
+            }
+        }
+        catch (const logic_error&) {
+            return false;
+        }
+        return !record.samples.empty();
+    }
+};
+
+// ====================   ====================
+
+//  ,     BenchmarkSink.
+//   ,    
+class BenchmarkRun {
+public:
+    BenchmarkRun() : environment(BenchmarkEnvironment::detect()) {
+        timestamp = duration_cast<seconds>(system_clock::now().time_since_epoch()).count();
+        mt19937 gen(random_device{}());
+        char suffix[8];
+        snprintf(suffix, sizeof(suffix), "%04x", (unsigned)(gen() & 0xFFFF));
+        runId = to_string(timestamp) + "-" + suffix;
+
+        previousHandler = BenchmarkSink::handler();
+        BenchmarkSink::handler() = [this](const string& benchmark, const string& caseName,
+            const string& shape, double microseconds) {
+                add(benchmark, caseName, shape, microseconds);
+            };
+    }
+
+    ~BenchmarkRun() {
+        BenchmarkSink::handler() = previousHandler;
+    }
+
+    BenchmarkRun(const BenchmarkRun&) = delete;
+    BenchmarkRun& operator=(const BenchmarkRun&) = delete;
+
+    void add(const string& benchmark, const string& caseName, const string& shape,
+        double microseconds) {
+        auto key = make_tuple(benchmark, caseName, shape);
+        auto it = index.find(key);
+        if (it == index.end()) {
+            it = index.emplace(key, cases.size()).first;
+            cases.push_back({ benchmark, caseName, shape, {} });
+        }
+        cases[it->second].samples.push_back(microseconds);
+    }
+
+    //      
+    vector<BenchmarkRecord> records() const {
+        vector<BenchmarkRecord> result;
+        result.reserve(cases.size());
+        for (const CaseSamples& c : cases) {
+            BenchmarkRecord record;
+            record.runId = runId;
+            record.timestamp = timestamp;
+            record.environment = environment;
+            record.benchmark = c.benchmark;
+            record.caseName = c.caseName;
+            record.shape = c.shape;
+            record.samples = c.samples;
+            result.push_back(move(record));
+        }
+        return result;
+    }
+
+    void saveTo(const BenchmarkResultStore& store) const {
+        store.append(records());
+    }
+
+    const string& getRunId() const {
+        return runId;
+    }
+
+    const BenchmarkEnvironment& getEnvironment() const {
+        return environment;
+    }
+
+private:
+    struct CaseSamples {
+        string benchmark;
+        string caseName;
+        string shape;
+        vector<double> samples;
+    };
+
+    BenchmarkEnvironment environment;
+    string runId;
+    long long timestamp = 0;
+    vector<CaseSamples> cases;
+    map<tuple<string, string, string>, size_t> index;
+    BenchmarkSink::Handler previousHandler;
+};
+
+// ====================   ====================
+
+enum class RegressionVerdict {
+    Unchanged,
+    Faster,
+    Slower,
+    NotEnoughSamples
+};
+
+struct CaseComparison {
+    string key;
+    size_t baselineSamples = 0;
+    size_t candidateSamples = 0;
+    double baselineMedian = 0;
+    double candidateMedian = 0;
+    double ratio = 1;         //   /  
+    double pValue = 1;
+    RegressionVerdict verdict = RegressionVerdict::NotEnoughSamples;
+};
+
+//   -     
+//  .   ,     
+//     :     
+//     ,   -   
+class RegressionDetector {
+public:
+    struct Options {
+        double threshold = 0.05;  //   
+        double alpha = 0.01;      //  
+        size_t minSamples = 5;    //   
+        double minDeltaUs = 2;    //      
+    };
+
+    static double median(vector<double> values) {
+        if (values.empty()) return 0;
+        size_t middle = values.size() / 2;
+        nth_element(values.begin(), values.begin() + middle, values.end());
+        double upper = values[middle];
+        if (values.size() % 2 == 1) return upper;
+        return (*max_element(values.begin(), values.begin() + middle) + upper) / 2;
+    }
+
+    static double mannWhitneyPValue(const vector<double>& a, const vector<double>& b) {
+        const size_t n1 = a.size(), n2 = b.size();
+        if (n1 == 0 || n2 == 0) return 1;
+
+        vector<pair<double, int>> all;
+        all.reserve(n1 + n2);
+        for (double x : a) all.push_back({ x, 0 });
+        for (double x : b) all.push_back({ x, 1 });
+        sort(all.begin(), all.end());
+
+        //        sum(t^3 - t)
+        double rankSumA = 0;
+        double tieTerm = 0;
+        for (size_t i = 0; i < all.size();) {
+            size_t j = i;
+            while (j < all.size() && all[j].first == all[i].first) j++;
+            double averageRank = (i + 1 + j) / 2.0;
+            for (size_t k = i; k < j; k++) {
+                if (all[k].second == 0) rankSumA += averageRank;
+            }
+            double t = (double)(j - i);
+            tieTerm += t * t * t - t;
+            i = j;
+        }
+
+        const double N = (double)(n1 + n2);
+        double u = rankSumA - n1 * (n1 + 1) / 2.0;
+        double mean = n1 * (double)n2 / 2.0;
+        double variance = n1 * (double)n2 / 12.0 * ((N + 1) - tieTerm / (N * (N - 1)));
+        if (variance <= 0) return 1;  //   
+
+        double z = (fabs(u - mean) - 0.5) / sqrt(variance);  //   
+        if (z < 0) z = 0;
+        return erfc(z / sqrt(2.0));
+    }
+
+    static CaseComparison compareCase(const string& key, const vector<double>& baseline,
+        const vector<double>& candidate, const Options& options) {
+        CaseComparison result;
+        result.key = key;
+        result.baselineSamples = baseline.size();
+        result.candidateSamples = candidate.size();
+        result.baselineMedian = median(baseline);
+        result.candidateMedian = median(candidate);
+        result.ratio = result.baselineMedian > 0
+            ? result.candidateMedian / result.baselineMedian
+            : (result.candidateMedian > 0 ? INFINITY : 1.0);
+
+        if (baseline.size() < options.minSamples || candidate.size() < options.minSamples) {
+            result.verdict = RegressionVerdict::NotEnoughSamples;
+            return result;
+        }
+
+        result.pValue = mannWhitneyPValue(baseline, candidate);
+        double delta = result.candidateMedian - result.baselineMedian;
+        bool significant = result.pValue < options.alpha && fabs(delta) >= options.minDeltaUs;
+        if (significant && result.ratio > 1 + options.threshold) {
+            result.verdict = RegressionVerdict::Slower;
+        }
+        else if (significant && result.ratio < 1 - options.threshold) {
+            result.verdict = RegressionVerdict::Faster;
+        }
+        else {
+            result.verdict = RegressionVerdict::Unchanged;
+        }
+        return result;
+    }
+
+    //    benchmark/caseName/shape; , 
+    //     , 
+    static vector<CaseComparison> compare(const vector<BenchmarkRecord>& baseline,
+        const vector<BenchmarkRecord>& candidate, const Options& options) {
+        map<string, vector<double>> baseSamples;
+        for (const BenchmarkRecord& record : baseline) {
+            auto& samples = baseSamples[record.caseKey()];
+            samples.insert(samples.end(), record.samples.begin(), record.samples.end());
+        }
+
+        vector<string> order;
+        map<string, vector<double>> candidateSamples;
+        for (const BenchmarkRecord& record : candidate) {
+            auto inserted = candidateSamples.emplace(record.caseKey(), vector<double>());
+            if (inserted.second) order.push_back(record.caseKey());
+            auto& samples = inserted.first->second;
+            samples.insert(samples.end(), record.samples.begin(), record.samples.end());
+        }
+
+        vector<CaseComparison> results;
+        for (const string& key : order) {
+            auto it = baseSamples.find(key);
+            if (it == baseSamples.end()) continue;
+            results.push_back(compareCase(key, it->second, candidateSamples[key], options));
+        }
+        return results;
+    }
+
+    static size_t countRegressions(const vector<CaseComparison>& results) {
+        return count_if(results.begin(), results.end(), [](const CaseComparison& c) {
+            return c.verdict == RegressionVerdict::Slower;
+            });
+    }
+};
+
+// ====================   ====================
+
+// :
+//   --bench-record <> []            
+//   --bench-compare <> [ ] [--threshold x] [--alpha x]
+//   --bench-list <>                     
+//     -  ,  -  
+//    ,   .
+//  : 0 -  , 1 -  , 2 - 
+class BenchmarkTool {
+public:
+    using Suite = pair<string, function<void()>>;
+
+    static constexpr int EXIT_OK = 0;
+    static constexpr int EXIT_REGRESSION = 1;
+    static constexpr int EXIT_ERROR = 2;
+
+    static bool handles(int argc, char* argv[]) {
+        if (argc < 2) return false;
+        string mode = argv[1];
+        return mode == "--bench-record" || mode == "--bench-compare" || mode == "--bench-list";
+    }
+
+    static int run(int argc, char* argv[], const vector<Suite>& suites) {
+        try {
+            vector<string> args(argv + 1, argv + argc);
+            if (args.size() < 2) {
+                printUsage();
+                return EXIT_ERROR;
+            }
+            BenchmarkResultStore store(args[1]);
+            if (args[0] == "--bench-record") {
+                int repetitions = args.size() > 2 ? stoi(args[2]) : 5;
+                return record(store, suites, repetitions);
+            }
+            if (args[0] == "--bench-list") {
+                return list(store);
+            }
+
+            RegressionDetector::Options options;
+            vector<string> runs;
+            for (size_t i = 2; i < args.size(); i++) {
+                if (args[i] == "--threshold" && i + 1 < args.size()) {
+                    options.threshold = stod(args[++i]);
+                }
+                else if (args[i] == "--alpha" && i + 1 < args.size()) {
+                    options.alpha = stod(args[++i]);
+                }
+                else {
+                    runs.push_back(args[i]);
+                }
+            }
+            if (runs.size() != 0 && runs.size() != 2) {
+                printUsage();
+                return EXIT_ERROR;
+            }
+            return compare(store, runs, options);
+        }
+        catch (const exception& e) {
+            cerr << ": " << e.what() << endl;
+            return EXIT_ERROR;
+        }
+    }
+
+    static int record(const BenchmarkResultStore& store, const vector<Suite>& suites,
+        int repetitions) {
+        if (repetitions < 1) {
+            throw invalid_argument("    ");
+        }
+
+        BenchmarkRun run;
+        ostringstream discarded;
+        for (int r = 0; r < repetitions; r++) {
+            for (const Suite& suite : suites) {
+                cerr << " " << (r + 1) << "/" << repetitions << ": " << suite.first << endl;
+                //       
+                streambuf* previous = cout.rdbuf(discarded.rdbuf());
+                try {
+                    suite.second();
+                }
+                catch (...) {
+                    cout.rdbuf(previous);
+                    throw;
+                }
+                cout.rdbuf(previous);
+                discarded.str("");
+            }
+        }
+
+        run.saveTo(store);
+        const BenchmarkEnvironment& env = run.getEnvironment();
+        cout << " " << run.getRunId() << "   " << store.getPath() << endl;
+        cout << "  : " << env.machine << " (" << env.machineInfo << ")" << endl;
+        cout << "  : " << env.compiler << ", : " << env.flags << endl;
+        cout << "  : " << env.revision << endl;
+        cout << "  : " << run.records().size() << ", : " << repetitions << endl;
+        return EXIT_OK;
+    }
+
+    static int list(const BenchmarkResultStore& store) {
+        vector<BenchmarkRecord> records = store.load();
+        for (const string& id : BenchmarkResultStore::runIds(records)) {
+            vector<BenchmarkRecord> run = BenchmarkResultStore::selectRun(records, id);
+            const BenchmarkEnvironment& env = run.front().environment;
+            cout << id << "   " << env.revision << "   " << env.machine
+                << "   [" << env.flags << "]   " << run.size() << endl;
+        }
+        return EXIT_OK;
+    }
+
+    static int compare(const BenchmarkResultStore& store, const vector<string>& runs,
+        const RegressionDetector::Options& options) {
+        vector<BenchmarkRecord> records = store.load();
+        vector<string> ids = BenchmarkResultStore::runIds(records);
+
+        string baselineId, candidateId;
+        if (runs.size() == 2) {
+            baselineId = runs[0];
+            candidateId = runs[1];
+        }
+        else {
+            if (ids.empty()) {
+                throw runtime_error("   ");
+            }
+            candidateId = ids.back();
+            string key = BenchmarkResultStore::selectRun(records, candidateId)
+                .front().environment.configurationKey();
+            for (size_t i = ids.size() - 1; i-- > 0;) {
+                if (BenchmarkResultStore::selectRun(records, ids[i])
+                    .front().environment.configurationKey() == key) {
+                    baselineId = ids[i];
+                    break;
+                }
+            }
+            if (baselineId.empty()) {
+                throw runtime_error("         ");
+            }
+        }
+
+        vector<BenchmarkRecord> baseline = BenchmarkResultStore::selectRun(records, baselineId);
+        vector<BenchmarkRecord> candidate = BenchmarkResultStore::selectRun(records, candidateId);
+        if (baseline.empty() || candidate.empty()) {
+            throw runtime_error("  : " + (baseline.empty() ? baselineId : candidateId));
+        }
+
+        const BenchmarkEnvironment& baseEnv = baseline.front().environment;
+        const BenchmarkEnvironment& candEnv = candidate.front().environment;
+        cout << ":     " << baselineId << " ( " << baseEnv.revision << ")" << endl;
+        cout << ": " << candidateId << " ( " << candEnv.revision << ")" << endl;
+        if (baseEnv.configurationKey() != candEnv.configurationKey()) {
+            cout << ":         " << endl;
+        }
+
+        vector<CaseComparison> results = RegressionDetector::compare(baseline, candidate, options);
+        for (const CaseComparison& c : results) {
+            printf("  %-12s %10.1f -> %10.1f   x%-6.3f p=%-8.2g %s\n",
+                verdictName(c.verdict), c.baselineMedian, c.candidateMedian,
+                c.ratio, c.pValue, c.key.c_str());
+        }
+
+        size_t regressions = RegressionDetector::countRegressions(results);
+        cout << " : " << results.size() << ", : " << regressions
+            << " ( " << options.threshold * 100 << "%, alpha " << options.alpha << ")" << endl;
+        return regressions > 0 ? EXIT_REGRESSION : EXIT_OK;
+    }
+
+private:
+    static const char* verdictName(RegressionVerdict verdict) {
+        switch (verdict) {
+        case RegressionVerdict::Faster: return "";
+        case RegressionVerdict::Slower: return "";
+        case RegressionVerdict::NotEnoughSamples: return " ";
+        default: return " .";
+        }
+    }
+
+    static void printUsage() {
+        cerr << ":" << endl
+            << "  --bench-record <> []" << endl
+            << "  --bench-compare <> [ ] [--threshold 0.05] [--alpha 0.01]" << endl
+            << "  --bench-list <>" << endl;
+    }
+};
+
+// ====================  ====================
+
+class BenchmarkStoreBenchmark {
+public:
+    //      
+    static bool verify() {
+        cout << "===    ===" << endl;
+        bool ok = true;
+
+        // :   -  ,  - 
+        vector<double> a = { 100, 101, 99, 102, 98, 100, 101, 99, 100, 100 };
+        vector<double> same = { 99, 100, 101, 100, 102, 98, 100, 99, 101, 100 };
+        vector<double> slower = { 120, 121, 119, 122, 118, 120, 121, 119, 120, 120 };
+        double pSame = RegressionDetector::mannWhitneyPValue(a, same);
+        double pSlower = RegressionDetector::mannWhitneyPValue(a, slower);
+        cout << "  p () = " << pSame << ", p (  20%) = " << pSlower << endl;
+        ok = ok && pSame > 0.5 && pSlower < 0.001;
+
+        // ,     
+        string path = "benchmark_store_verify.tsv";
+        remove(path.c_str());
+        BenchmarkResultStore store(path);
+
+        auto fakeRun = [&](const vector<double>& merge, const vector<double>& quick) {
+            BenchmarkRun run;
+            for (size_t i = 0; i < merge.size(); i++) {
+                BenchmarkSink::report("verify", "merge", "n=1000;random\twith tab", merge[i]);
+                BenchmarkSink::report("verify", "quick", "n=1000;random", quick[i]);
+            }
+            run.saveTo(store);
+            return run.getRunId();
+        };
+        string base = fakeRun(a, a);
+        string cand = fakeRun(same, slower);
+
+        vector<BenchmarkRecord> records = store.load();
+        ok = ok && records.size() == 4 && BenchmarkResultStore::runIds(records).size() == 2;
+        ok = ok && records[0].shape == "n=1000;random\twith tab" && records[0].samples == a;
+
+        vector<CaseComparison> results = RegressionDetector::compare(
+            BenchmarkResultStore::selectRun(records, base),
+            BenchmarkResultStore::selectRun(records, cand), RegressionDetector::Options());
+        ok = ok && results.size() == 2 &&
+            results[0].verdict == RegressionVerdict::Unchanged &&
+            results[1].verdict == RegressionVerdict::Slower;
+
+        int code = BenchmarkTool::compare(store, {}, RegressionDetector::Options());
+        ok = ok && code == BenchmarkTool::EXIT_REGRESSION;
+        remove(path.c_str());
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,339 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+
+//   :   <  " "
+enum class GrowthOrder {
+    Constant,
+    Logarithmic,
+    Linear,
+    Linearithmic,
+    Quadratic,
+    Exponential
+};
+
+inline const char* growthOrderName(GrowthOrder order) {
+    switch (order) {
+    case GrowthOrder::Constant: return "O(1)";
+    case GrowthOrder::Logarithmic: return "O(log n)";
+    case GrowthOrder::Linear: return "O(n)";
+    case GrowthOrder::Linearithmic: return "O(n log n)";
+    case GrowthOrder::Quadratic: return "O(n^2)";
+    default: return "O(2^n)";
+    }
+}
+
+//  g(n)  ;  2^n   n  
+inline double growthFunction(GrowthOrder order, double n) {
+    switch (order) {
+    case GrowthOrder::Constant: return 1;
+    case GrowthOrder::Logarithmic: return log2(n);
+    case GrowthOrder::Linear: return n;
+    case GrowthOrder::Linearithmic: return n * log2(n);
+    case GrowthOrder::Quadratic: return n * n;
+    default: return exp2(n);
+    }
+}
+
+// ====================   ====================
+
+struct ComplexitySample {
+    long long n = 0;
+    double nanoseconds = 0;   //    
+};
+
+struct ComplexityFit {
+    GrowthOrder order = GrowthOrder::Constant;
+    double coefficient = 0;     // t(n) ~ coefficient * g(n), 
+    double rms = 0;             //  , 
+    double normalizedRms = 0;   // rms /  
+    vector<ComplexitySample> samples;
+};
+
+//    n,      
+//      t(n) = c * g(n)   .
+//     :    n  
+//     
+class ComplexityFitter {
+public:
+    struct Options {
+        long long minN = 8;
+        long long maxN = 1 << 20;
+        double growth = 2;          //    n
+        int repetitions = 7;
+        double minBatchUs = 200;    //      
+        double maxCallMs = 50;      // ,     (  ),  
+        size_t minPoints = 5;
+    };
+
+    // run(n) -  
+    template<typename Run>
+    static vector<ComplexitySample> sweep(Run run, const Options& options) {
+        return sweep([](long long n) { return n; },
+            [&run](long long& n) { return run(n); }, options);
+    }
+
+    // setup(n)    , run(input) -  .
+    //   run    ,  run   
+    template<typename Setup, typename Run>
+    static vector<ComplexitySample> sweep(Setup setup, Run run, const Options& options) {
+        if (options.minN < 1 || options.maxN < options.minN || options.growth <= 1 ||
+            options.repetitions < 1) {
+            throw invalid_argument("   ");
+        }
+
+        vector<ComplexitySample> samples;
+        long long n = options.minN;
+        while (n <= options.maxN) {
+            if (predictNs(samples, n) > options.maxCallMs * 1e6) break;
+
+            double ns = measureSize(setup, run, n, options);
+            samples.push_back({ n, ns });
+            if (ns > options.maxCallMs * 1e6) break;
+
+            long long next = (long long)ceil(n * options.growth);
+            n = max(next, n + 1);
+        }
+        return samples;
+    }
+
+    //  run,    : setup     ,
+    //    run      
+    template<typename Setup, typename Run>
+    static vector<ComplexitySample> sweepShared(Setup setup, Run run, const Options& options) {
+        using Input = decay_t<invoke_result_t<Setup&, long long>>;
+        shared_ptr<const Input> current;
+        long long currentN = -1;
+        return sweep([&](long long n) {
+            if (n != currentN) {
+                current.reset();
+                current = make_shared<const Input>(setup(n));
+                currentN = n;
+            }
+            return current;
+            },
+            [&run](shared_ptr<const Input>& input) { return run(*input); }, options);
+    }
+
+    //     
+    static ComplexityFit fit(const vector<ComplexitySample>& samples) {
+        if (samples.empty()) {
+            throw invalid_argument("    ");
+        }
+
+        ComplexityFit best;
+        best.rms = INFINITY;
+        for (GrowthOrder order : { GrowthOrder::Constant, GrowthOrder::Logarithmic,
+            GrowthOrder::Linear, GrowthOrder::Linearithmic, GrowthOrder::Quadratic,
+            GrowthOrder::Exponential }) {
+            ComplexityFit candidate = fitOrder(samples, order);
+            if (candidate.rms < best.rms) {
+                best = candidate;
+            }
+        }
+        best.samples = samples;
+        return best;
+    }
+
+    //    : c = sum(t*g) / sum(g*g)
+    static ComplexityFit fitOrder(const vector<ComplexitySample>& samples, GrowthOrder order) {
+        ComplexityFit result;
+        result.order = order;
+        result.rms = INFINITY;
+
+        double sumTG = 0, sumGG = 0, sumT = 0;
+        for (const ComplexitySample& s : samples) {
+            double g = growthFunction(order, (double)s.n);
+            if (!isfinite(g)) return result;
+            sumTG += s.nanoseconds * g;
+            sumGG += g * g;
+            sumT += s.nanoseconds;
+        }
+        if (sumGG == 0 || !isfinite(sumGG)) return result;
+
+        result.coefficient = sumTG / sumGG;
+        double sumSquares = 0;
+        for (const ComplexitySample& s : samples) {
+            double error = s.nanoseconds - result.coefficient * growthFunction(order, (double)s.n);
+            sumSquares += error * error;
+        }
+        result.rms = sqrt(sumSquares / samples.size());
+        double mean = sumT / samples.size();
+        result.normalizedRms = mean > 0 ? result.rms / mean : 0;
+        return result;
+    }
+
+    template<typename Run>
+    static ComplexityFit measure(Run run, const Options& options) {
+        return fit(sweep(run, options));
+    }
+
+    template<typename Setup, typename Run>
+    static ComplexityFit measure(Setup setup, Run run, const Options& options) {
+        return fit(sweep(setup, run, options));
+    }
+
+    template<typename Setup, typename Run>
+    static ComplexityFit measureShared(Setup setup, Run run, const Options& options) {
+        return fit(sweepShared(setup, run, options));
+    }
+
+    //  ; false,     
+    static bool report(const string& name, const ComplexityFit& fit, GrowthOrder expected,
+        const Options& options) {
+        bool ok = fit.order <= expected;
+        bool enoughPoints = fit.samples.size() >= options.minPoints;
+        printf("  %-32s %-11s c = %-10.4g   RMS %5.1f%%  n = %lld..%lld  ( %s) %s\n",
+            name.c_str(), growthOrderName(fit.order), fit.coefficient, fit.normalizedRms * 100,
+            fit.samples.front().n, fit.samples.back().n, growthOrderName(expected),
+            !enoughPoints ? " " : ok ? "OK" : "");
+        return ok || !enoughPoints;
+    }
+
+    //     ,    
+    template<typename T>
+    static void keepAlive(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+
+private:
+    // ,       
+    template<typename T>
+    static void opaque(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : "+r,m"(value) : : "memory");
+#else
+        static T* volatile sink;
+        sink = &value;
+#endif
+    }
+
+    template<typename Run, typename Input>
+    static void invoke(Run& run, Input& input) {
+        if constexpr (is_void_v<invoke_result_t<Run&, Input&>>) {
+            run(input);
+        }
+        else {
+            keepAlive(run(input));
+        }
+    }
+
+    //    iterations ,   
+    template<typename Setup, typename Run>
+    static double timeBatch(Setup& setup, Run& run, long long n, long long iterations) {
+        using Input = decay_t<invoke_result_t<Setup&, long long>>;
+        vector<Input> inputs;
+        inputs.reserve((size_t)iterations);
+        for (long long i = 0; i < iterations; i++) {
+            inputs.push_back(setup(n));
+        }
+
+        auto start = steady_clock::now();
+        for (Input& input : inputs) {
+            opaque(input);
+            invoke(run, input);
+        }
+        auto end = steady_clock::now();
+        return (double)duration_cast<nanoseconds>(end - start).count();
+    }
+
+    template<typename Setup, typename Run>
+    static double measureSize(Setup& setup, Run& run, long long n, const Options& options) {
+        // :  ,      minBatchUs
+        long long iterations = 1;
+        double batchNs = timeBatch(setup, run, n, iterations);
+        while (batchNs < options.minBatchUs * 1000 && iterations < (1LL << 24)) {
+            iterations *= 2;
+            batchNs = timeBatch(setup, run, n, iterations);
+        }
+
+        vector<double> perCall;
+        perCall.push_back(batchNs / iterations);
+        for (int r = 1; r < options.repetitions; r++) {
+            perCall.push_back(timeBatch(setup, run, n, iterations) / iterations);
+        }
+        nth_element(perCall.begin(), perCall.begin() + perCall.size() / 2, perCall.end());
+        return perCall[perCall.size() / 2];
+    }
+
+    //         .
+    //    ,     n  
+    //      
+    static double predictNs(const vector<ComplexitySample>& samples, long long n) {
+        if (samples.size() < 2) return 0;
+        const ComplexitySample& a = samples[samples.size() - 2];
+        const ComplexitySample& b = samples.back();
+        if (a.nanoseconds <= 0 || b.nanoseconds <= a.nanoseconds) return b.nanoseconds;
+        double exponent = log(b.nanoseconds / a.nanoseconds) / log((double)b.n / a.n);
+        return b.nanoseconds * pow((double)n / b.n, exponent);
+    }
+};
+
+// ====================  ====================
+
+class ComplexityFitBenchmark {
+public:
+    //         
+    static bool verify() {
+        cout << "===    ===" << endl;
+        bool ok = true;
+
+        for (GrowthOrder order : { GrowthOrder::Constant, GrowthOrder::Logarithmic,
+            GrowthOrder::Linear, GrowthOrder::Linearithmic, GrowthOrder::Quadratic,
+            GrowthOrder::Exponential }) {
+            vector<ComplexitySample> samples;
+            long long maxN = order == GrowthOrder::Exponential ? 32 : 1 << 20;
+            mt19937 gen(7);
+            uniform_real_distribution<double> noise(0.97, 1.03);
+            for (long long n = 2; n <= maxN; n *= 2) {
+                samples.push_back({ n, 3.5 * growthFunction(order, (double)n) * noise(gen) });
+            }
+            ComplexityFit fit = ComplexityFitter::fit(samples);
+            ok = ok && fit.order == order && fabs(fit.coefficient / 3.5 - 1) < 0.05;
+        }
+        cout << "   : " << (ok ? "OK" : "") << endl;
+
+        //   -  :       
+        //   ,       
+        ComplexityFitter::Options options;
+        options.maxN = 1 << 18;
+        ComplexityFitter::report("accumulate", ComplexityFitter::measure(
+            [](long long n) { return vector<int>((size_t)n, 1); },
+            [](vector<int>& v) { return accumulate(v.begin(), v.end(), 0LL); }, options),
+            GrowthOrder::Linear, options);
+        ComplexityFitter::report("sort", ComplexityFitter::measure(
+            [](long long n) {
+                vector<int> v((size_t)n);
+                mt19937 gen((unsigned)n);
+                for (int& x : v) x = (int)gen();
+                return v;
+            },
+            [](vector<int>& v) { sort(v.begin(), v.end()); }, options),
+            GrowthOrder::Linearithmic, options);
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+};
\ No newline at end of file
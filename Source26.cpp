@@ -0,0 +1,473 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <functional>
+#include <utility>
+#include <tuple>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+
+// std::hash   -  ,    
+//     ,    
+inline uint64_t mixHash(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+//   ,      (   )
+template<typename T>
+struct MemoHash {
+    uint64_t operator()(const T& value) const {
+        return mixHash((uint64_t)hash<T>()(value));
+    }
+};
+
+template<typename A, typename B>
+struct MemoHash<pair<A, B>> {
+    uint64_t operator()(const pair<A, B>& value) const {
+        return mixHash(MemoHash<A>()(value.first) * 31 + MemoHash<B>()(value.second));
+    }
+};
+
+template<typename... Ts>
+struct MemoHash<tuple<Ts...>> {
+    uint64_t operator()(const tuple<Ts...>& value) const {
+        uint64_t h = 0;
+        apply([&h](const Ts&... parts) {
+            ((h = mixHash(h * 31 + MemoHash<Ts>()(parts))), ...);
+            }, value);
+        return h;
+    }
+};
+
+// ====================   ====================
+
+struct MemoStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+
+    double hitRate() const {
+        uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : (double)hits / total;
+    }
+};
+
+//  -    ( ),
+//      : ,    ,
+//    .       CLOCK:
+//         ,   
+// ,       
+template<typename Key, typename Value, typename Hash = MemoHash<Key>>
+class ConcurrentMemoCache {
+public:
+    struct Options {
+        size_t capacity = 0;    // 0 -  
+        size_t shards = 16;     //     
+    };
+
+    ConcurrentMemoCache() : ConcurrentMemoCache(Options()) {}
+
+    explicit ConcurrentMemoCache(const Options& options) {
+        if (options.shards == 0) {
+            throw invalid_argument("    ");
+        }
+        size_t shardCount = 1;
+        while (shardCount < options.shards) shardCount *= 2;
+        shardBits = 0;
+        while ((size_t(1) << shardBits) < shardCount) shardBits++;
+
+        shards = vector<Shard>(shardCount);
+        for (Shard& shard : shards) {
+            if (options.capacity > 0) {
+                shard.limit = max<size_t>(1, (options.capacity + shardCount - 1) / shardCount);
+                //    :   
+                shard.slots.resize(tableSizeFor(shard.limit * 2));
+            }
+            else {
+                shard.slots.resize(INITIAL_SLOTS);
+            }
+        }
+    }
+
+    ConcurrentMemoCache(const ConcurrentMemoCache&) = delete;
+    ConcurrentMemoCache& operator=(const ConcurrentMemoCache&) = delete;
+
+    bool find(const Key& key, Value& value) {
+        uint64_t h = hasher(key);
+        Shard& shard = shardFor(h);
+        lock_guard<mutex> guard(shard.lock);
+        size_t index = shard.findIndex(key, h);
+        if (index == NOT_FOUND) {
+            shard.misses++;
+            return false;
+        }
+        Slot& slot = shard.slots[index];
+        slot.referenced = true;
+        value = slot.value;
+        shard.hits++;
+        return true;
+    }
+
+    //      (    )
+    //   
+    void insert(const Key& key, const Value& value) {
+        uint64_t h = hasher(key);
+        Shard& shard = shardFor(h);
+        lock_guard<mutex> guard(shard.lock);
+        size_t index = shard.findIndex(key, h);
+        if (index != NOT_FOUND) {
+            shard.slots[index].value = value;
+            return;
+        }
+
+        if (shard.limit > 0) {
+            if (shard.count >= shard.limit) {
+                shard.evictOne();
+            }
+        }
+        else if ((shard.count + 1) * 10 > shard.slots.size() * 7) {
+            shard.grow();
+        }
+        shard.place(key, value, h);
+    }
+
+    void clear() {
+        for (Shard& shard : shards) {
+            lock_guard<mutex> guard(shard.lock);
+            for (Slot& slot : shard.slots) slot = Slot();
+            shard.count = 0;
+            shard.hand = 0;
+        }
+    }
+
+    MemoStats getStats() const {
+        MemoStats stats;
+        for (const Shard& shard : shards) {
+            lock_guard<mutex> guard(shard.lock);
+            stats.hits += shard.hits;
+            stats.misses += shard.misses;
+            stats.evictions += shard.evictions;
+            stats.size += shard.count;
+        }
+        return stats;
+    }
+
+    void resetStats() {
+        for (Shard& shard : shards) {
+            lock_guard<mutex> guard(shard.lock);
+            shard.hits = shard.misses = shard.evictions = 0;
+        }
+    }
+
+private:
+    static constexpr size_t NOT_FOUND = SIZE_MAX;
+    static constexpr size_t INITIAL_SLOTS = 16;
+
+    struct Slot {
+        Key key{};
+        Value value{};
+        uint64_t hash = 0;
+        bool occupied = false;
+        bool referenced = false;
+    };
+
+    //     ,  - 
+    struct alignas(64) Shard {
+        mutable mutex lock;
+        vector<Slot> slots;
+        size_t count = 0;
+        size_t limit = 0;
+        size_t hand = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+
+        size_t mask() const {
+            return slots.size() - 1;
+        }
+
+        size_t findIndex(const Key& key, uint64_t h) const {
+            for (size_t i = h & mask();; i = (i + 1) & mask()) {
+                const Slot& slot = slots[i];
+                if (!slot.occupied) return NOT_FOUND;
+                if (slot.hash == h && slot.key == key) return i;
+            }
+        }
+
+        void place(const Key& key, const Value& value, uint64_t h) {
+            size_t i = h & mask();
+            while (slots[i].occupied) i = (i + 1) & mask();
+            slots[i].key = key;
+            slots[i].value = value;
+            slots[i].hash = h;
+            slots[i].occupied = true;
+            slots[i].referenced = false;
+            count++;
+        }
+
+        void grow() {
+            vector<Slot> old = move(slots);
+            slots = vector<Slot>(old.size() * 2);
+            count = 0;
+            for (Slot& slot : old) {
+                if (slot.occupied) place(slot.key, slot.value, slot.hash);
+            }
+        }
+
+        void evictOne() {
+            while (true) {
+                hand &= mask();
+                Slot& slot = slots[hand];
+                if (slot.occupied) {
+                    if (!slot.referenced) {
+                        erase(hand);
+                        evictions++;
+                        return;
+                    }
+                    slot.referenced = false;
+                }
+                hand++;
+            }
+        }
+
+        //    :      
+        void erase(size_t index) {
+            size_t hole = index;
+            for (size_t i = (index + 1) & mask(); slots[i].occupied; i = (i + 1) & mask()) {
+                size_t home = slots[i].hash & mask();
+                //     ,    
+                //        
+                bool between = hole <= i ? (hole < home && home <= i) : (hole < home || home <= i);
+                if (!between) {
+                    slots[hole] = move(slots[i]);
+                    hole = i;
+                }
+            }
+            slots[hole] = Slot();
+            count--;
+        }
+    };
+
+    static size_t tableSizeFor(size_t n) {
+        size_t size = INITIAL_SLOTS;
+        while (size < n) size *= 2;
+        return size;
+    }
+
+    Shard& shardFor(uint64_t h) {
+        return shards[shardBits == 0 ? 0 : (size_t)(h >> (64 - shardBits))];
+    }
+
+    Hash hasher;
+    vector<Shard> shards;
+    unsigned shardBits = 0;
+};
+
+// ====================  ====================
+
+//     .     
+//       :
+//   auto fib = memoize<int, long long>([](auto& self, int n) -> long long {
+//       return n <= 1 ? n : self(n - 1) + self(n - 2);
+//   });
+//      ,   
+// ,         
+template<typename Key, typename Value, typename Func, typename Hash = MemoHash<Key>>
+class Memoized {
+public:
+    using Options = typename ConcurrentMemoCache<Key, Value, Hash>::Options;
+
+    Memoized(Func func, const Options& options) : func(move(func)), cache(options) {}
+
+    Value operator()(const Key& key) {
+        Value value;
+        if (cache.find(key, value)) {
+            return value;
+        }
+        value = func(*this, key);
+        cache.insert(key, value);
+        return value;
+    }
+
+    MemoStats getStats() const {
+        return cache.getStats();
+    }
+
+    void clear() {
+        cache.clear();
+    }
+
+    void resetStats() {
+        cache.resetStats();
+    }
+
+private:
+    Func func;
+    ConcurrentMemoCache<Key, Value, Hash> cache;
+};
+
+template<typename Key, typename Value, typename Hash = MemoHash<Key>, typename Func>
+Memoized<Key, Value, Func, Hash> memoize(Func func,
+    const typename ConcurrentMemoCache<Key, Value, Hash>::Options& options = {}) {
+    return Memoized<Key, Value, Func, Hash>(move(func), options);
+}
+
+// ====================    ====================
+
+class MemoizeBenchmark {
+public:
+    //   std::map   ,   
+    static bool verify() {
+        cout << "===   ===" << endl;
+        bool ok = true;
+
+        //  :   map
+        ConcurrentMemoCache<int, int> cache(ConcurrentMemoCache<int, int>::Options{ 0, 4 });
+        map<int, int> reference;
+        uint64_t state = 12345;
+        for (int i = 0; i < 200000 && ok; i++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            int key = (int)((state >> 33) % 5000);
+            int value = 0;
+            bool found = cache.find(key, value);
+            auto it = reference.find(key);
+            ok = found == (it != reference.end()) && (!found || value == it->second);
+            if (!found) {
+                cache.insert(key, key * 3);
+                reference[key] = key * 3;
+            }
+        }
+        ok = ok && cache.getStats().size == reference.size();
+
+        //  :   ,    
+        ConcurrentMemoCache<int, int> bounded(ConcurrentMemoCache<int, int>::Options{ 1000, 8 });
+        for (int i = 0; i < 100000 && ok; i++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            int key = (int)((state >> 33) % 20000);
+            int value = 0;
+            if (bounded.find(key, value)) {
+                ok = value == key + 1;
+            }
+            else {
+                bounded.insert(key, key + 1);
+            }
+            ok = ok && bounded.getStats().size <= 1000 + 8;
+        }
+        MemoStats boundedStats = bounded.getStats();
+        ok = ok && boundedStats.evictions > 0;
+
+        //   memoize,        
+        auto fib = memoize<int, long long>([](auto& self, int n) -> long long {
+            return n <= 1 ? n : self(n - 1) + self(n - 2);
+            });
+        ok = ok && fib(90) == 2880067194370816120LL;
+
+        auto paths = memoize<pair<int, int>, long long>([](auto& self, pair<int, int> cell) -> long long {
+            if (cell.first == 0 || cell.second == 0) return 1;
+            return self({ cell.first - 1, cell.second }) + self({ cell.first, cell.second - 1 });
+            });
+        ok = ok && paths({ 16, 16 }) == 601080390LL;  // C(32, 16)
+
+        //     
+        auto shared = memoize<int, long long>([](auto& self, int n) -> long long {
+            return n <= 1 ? n : self(n - 1) + self(n - 2);
+            }, { 64, 16 });
+        atomic<bool> threadsOk{ true };
+        vector<thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&, t]() {
+                for (int i = 0; i < 2000; i++) {
+                    int n = (i * 7 + t) % 91;
+                    if (shared(n) != fibonacciReference(n)) threadsOk = false;
+                }
+                });
+        }
+        for (thread& th : threads) th.join();
+        ok = ok && threadsOk;
+
+        MemoStats stats = shared.getStats();
+        cout << "    ( 64):  " << stats.hits << ",  " << stats.misses
+            << ",  " << stats.evictions << ",   " << stats.hitRate() * 100 << "%" << endl;
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //   ConcurrentMemoCache  map  
+    static void compareLookups(int keys = 100000, int lookups = 5000000, int threadCount = 4) {
+        cout << "\n===    map (" << keys << " , " << lookups
+            << " , " << threadCount << " ) ===" << endl;
+
+        map<int, long long> ordered;
+        mutex orderedLock;
+        ConcurrentMemoCache<int, long long> flat;
+        for (int k = 0; k < keys; k++) {
+            ordered[k] = k;
+            flat.insert(k, k);
+        }
+
+        auto run = [&](auto lookup) {
+            atomic<long long> checksum{ 0 };
+            auto start = high_resolution_clock::now();
+            vector<thread> threads;
+            for (int t = 0; t < threadCount; t++) {
+                threads.emplace_back([&, t]() {
+                    uint64_t state = 0x9E3779B97F4A7C15ULL * (t + 1);
+                    long long local = 0;
+                    for (int i = 0; i < lookups / threadCount; i++) {
+                        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                        local += lookup((int)((state >> 33) % keys));
+                    }
+                    checksum += local;
+                    });
+            }
+            for (thread& th : threads) th.join();
+            auto end = high_resolution_clock::now();
+            return make_pair(duration<double, nano>(end - start).count() / lookups, checksum.load());
+        };
+
+        auto mapResult = run([&](int key) {
+            lock_guard<mutex> guard(orderedLock);
+            auto it = ordered.find(key);
+            return it == ordered.end() ? 0LL : it->second;
+            });
+        auto flatResult = run([&](int key) {
+            long long value = 0;
+            flat.find(key, value);
+            return value;
+            });
+
+        cout << "  map + :        " << mapResult.first << " /" << endl;
+        cout << "  ConcurrentMemoCache:  " << flatResult.first << " /" << endl;
+        cout << "    " << (mapResult.second == flatResult.second ? "" : "") << endl;
+    }
+
+private:
+    static long long fibonacciReference(int n) {
+        long long a = 0, b = 1;
+        for (int i = 0; i < n; i++) {
+            long long next = a + b;
+            a = b;
+            b = next;
+        }
+        return a;
+    }
+};
\ No newline at end of file
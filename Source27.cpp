@@ -0,0 +1,522 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <array>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(_MSC_VER) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace chrono;
+
+// ==================== 128-  ====================
+
+#ifdef __SIZEOF_INT128__
+using UInt128 = unsigned __int128;
+#else
+//    __int128:  ,    
+// (   2^128)
+struct UInt128 {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    constexpr UInt128() = default;
+    constexpr UInt128(uint64_t value) : low(value), high(0) {}
+    constexpr UInt128(uint64_t high, uint64_t low) : low(low), high(high) {}
+
+    friend constexpr UInt128 operator+(UInt128 a, UInt128 b) {
+        uint64_t low = a.low + b.low;
+        return UInt128(a.high + b.high + (low < a.low ? 1 : 0), low);
+    }
+
+    friend constexpr UInt128 operator-(UInt128 a, UInt128 b) {
+        uint64_t low = a.low - b.low;
+        return UInt128(a.high - b.high - (a.low < b.low ? 1 : 0), low);
+    }
+
+    friend constexpr UInt128 operator*(UInt128 a, UInt128 b) {
+        // 64x64 -> 128  32- ,      2^64
+        uint64_t a0 = a.low & 0xFFFFFFFFULL, a1 = a.low >> 32;
+        uint64_t b0 = b.low & 0xFFFFFFFFULL, b1 = b.low >> 32;
+        uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+        uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+        uint64_t low = (middle << 32) | (p00 & 0xFFFFFFFFULL);
+        uint64_t high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+        high += a.low * b.high + a.high * b.low;
+        return UInt128(high, low);
+    }
+
+    friend constexpr bool operator==(UInt128 a, UInt128 b) {
+        return a.low == b.low && a.high == b.high;
+    }
+
+    friend constexpr bool operator!=(UInt128 a, UInt128 b) {
+        return !(a == b);
+    }
+};
+#endif
+
+//  64  
+inline uint64_t mulHigh64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+    uint64_t high;
+    _umul128(a, b, &high);
+    return high;
+#endif
+}
+
+// a * b mod m  
+inline uint64_t mulMod64(uint64_t a, uint64_t b, uint64_t m) {
+#ifdef __SIZEOF_INT128__
+    return (uint64_t)((unsigned __int128)a * b % m);
+#else
+    uint64_t high;
+    uint64_t low = _umul128(a, b, &high);
+    uint64_t remainder;
+    _udiv128(high % m, low, m, &remainder);
+    return remainder;
+#endif
+}
+
+// ====================  ====================
+
+// F(186) -   ,    128 
+constexpr int FIBONACCI_MAX_EXACT_INDEX = 186;
+
+constexpr array<UInt128, FIBONACCI_MAX_EXACT_INDEX + 1> makeFibonacciTable() {
+    array<UInt128, FIBONACCI_MAX_EXACT_INDEX + 1> table{};
+    table[0] = 0;
+    table[1] = 1;
+    for (int i = 2; i <= FIBONACCI_MAX_EXACT_INDEX; i++) {
+        table[i] = table[i - 1] + table[i - 2];
+    }
+    return table;
+}
+
+// F(0)..F(186),   
+inline constexpr array<UInt128, FIBONACCI_MAX_EXACT_INDEX + 1> FIBONACCI_TABLE = makeFibonacciTable();
+
+// ====================   ====================
+
+//    p < 2^32:     64 ,
+//     m = floor((2^64 - 1) / p)
+class BarrettModulus {
+public:
+    explicit BarrettModulus(uint64_t p) : p(p), m(UINT64_MAX / p) {
+        if (p == 0 || p >= (1ULL << 32)) {
+            throw invalid_argument("      [1, 2^32)");
+        }
+    }
+
+    uint64_t mul(uint64_t a, uint64_t b) const {
+        uint64_t x = a * b;
+        //        2
+        uint64_t r = x - mulHigh64(x, m) * p;
+        r = r >= p ? r - p : r;
+        return r >= p ? r - p : r;
+    }
+
+    uint64_t add(uint64_t a, uint64_t b) const {
+        uint64_t s = a + b;
+        return s >= p ? s - p : s;
+    }
+
+    uint64_t sub(uint64_t a, uint64_t b) const {
+        return a >= b ? a - b : a + p - b;
+    }
+
+    uint64_t toDomain(uint64_t x) const {
+        return x % p;
+    }
+
+    uint64_t fromDomain(uint64_t x) const {
+        return x;
+    }
+
+    uint64_t one() const {
+        return 1 % p;
+    }
+
+private:
+    uint64_t p;
+    uint64_t m;
+};
+
+//      p < 2^64:   
+// x * 2^64 mod p,  -      
+class MontgomeryModulus {
+public:
+    explicit MontgomeryModulus(uint64_t p) : p(p) {
+        if (p % 2 == 0) {
+            throw invalid_argument("    ");
+        }
+        // p^-1 mod 2^64  :      
+        inverse = p;
+        for (int i = 0; i < 5; i++) {
+            inverse *= 2 - p * inverse;
+        }
+        uint64_t r = (0 - p) % p;  // 2^64 mod p
+        r2 = mulMod64(r, r, p);
+    }
+
+    // REDC(a * b) = a * b * 2^-64 mod p
+    uint64_t mul(uint64_t a, uint64_t b) const {
+        uint64_t high = mulHigh64(a, b);
+        uint64_t low = a * b;
+        uint64_t q = low * inverse;
+        uint64_t qp = mulHigh64(q, p);
+        return high >= qp ? high - qp : high + p - qp;
+    }
+
+    uint64_t add(uint64_t a, uint64_t b) const {
+        // a, b < p,  a + b   64 
+        return a >= p - b ? a - (p - b) : a + b;
+    }
+
+    uint64_t sub(uint64_t a, uint64_t b) const {
+        return a >= b ? a - b : a + (p - b);
+    }
+
+    uint64_t toDomain(uint64_t x) const {
+        return mul(x % p, r2);
+    }
+
+    uint64_t fromDomain(uint64_t x) const {
+        return mul(x, 1);
+    }
+
+    uint64_t one() const {
+        return toDomain(1);
+    }
+
+private:
+    uint64_t p;
+    uint64_t inverse = 0;
+    uint64_t r2 = 0;
+};
+
+//    2^32:   128- 
+class GenericModulus {
+public:
+    explicit GenericModulus(uint64_t p) : p(p) {
+        if (p == 0) {
+            throw invalid_argument("   ");
+        }
+    }
+
+    uint64_t mul(uint64_t a, uint64_t b) const {
+        return mulMod64(a, b, p);
+    }
+
+    uint64_t add(uint64_t a, uint64_t b) const {
+        return a >= p - b ? a - (p - b) : a + b;
+    }
+
+    uint64_t sub(uint64_t a, uint64_t b) const {
+        return a >= b ? a - b : a + (p - b);
+    }
+
+    uint64_t toDomain(uint64_t x) const {
+        return x % p;
+    }
+
+    uint64_t fromDomain(uint64_t x) const {
+        return x;
+    }
+
+    uint64_t one() const {
+        return 1 % p;
+    }
+
+private:
+    uint64_t p;
+};
+
+// ====================   ====================
+
+// F(2k) = F(k) * (2F(k+1) - F(k)),  F(2k+1) = F(k)^2 + F(k+1)^2.
+//  n   : O(log n) 
+class FastFibonacci {
+public:
+    //  , n <= 186
+    static UInt128 exact(uint64_t n) {
+        if (n > FIBONACCI_MAX_EXACT_INDEX) {
+            throw out_of_range("F(" + to_string(n) + ")    128 ");
+        }
+        //  F(k+1)      , 
+        //      2^128,  F(n) < 2^128  
+        UInt128 a = 0, b = 1;
+        for (int bit = bitLength(n) - 1; bit >= 0; bit--) {
+            UInt128 c = a * (b + b - a);
+            UInt128 d = a * a + b * b;
+            if ((n >> bit) & 1) {
+                a = d;
+                b = c + d;
+            }
+            else {
+                a = c;
+                b = d;
+            }
+        }
+        return a;
+    }
+
+    static UInt128 fromTable(uint64_t n) {
+        if (n > FIBONACCI_MAX_EXACT_INDEX) {
+            throw out_of_range("F(" + to_string(n) + ")    128 ");
+        }
+        return FIBONACCI_TABLE[(size_t)n];
+    }
+
+    // F(n) mod p   n < 2^64
+    static uint64_t modular(uint64_t n, uint64_t p) {
+        uint64_t result = 0;
+        dispatch(p, [&](const auto& mod) {
+            result = mod.fromDomain(doubling(mod, n));
+            });
+        return result;
+    }
+
+    //    :    ,   
+    //    LANES   ,     
+    static vector<uint64_t> modularBatch(const vector<uint64_t>& indices, uint64_t p) {
+        vector<uint64_t> result(indices.size());
+        dispatch(p, [&](const auto& mod) {
+            batchKernel(mod, indices.data(), result.data(), indices.size());
+            });
+        return result;
+    }
+
+    static string toString(UInt128 value) {
+        if (value == UInt128(0)) return "0";
+        string digits;
+        while (value != UInt128(0)) {
+            uint64_t remainder = 0;
+            value = divideBy10(value, remainder);
+            digits += (char)('0' + remainder);
+        }
+        reverse(digits.begin(), digits.end());
+        return digits;
+    }
+
+private:
+    static constexpr size_t LANES = 4;
+
+    static int bitLength(uint64_t n) {
+        int bits = 0;
+        while (n > 0) {
+            bits++;
+            n >>= 1;
+        }
+        return bits;
+    }
+
+    // (a, b) = bit ? (d, c + d) : (c, d)  :   
+    // ,        
+    static void select(uint64_t bit, uint64_t c, uint64_t d, uint64_t sum, uint64_t& a, uint64_t& b) {
+        uint64_t mask = 0 - bit;
+        a = (d & mask) | (c & ~mask);
+        b = (sum & mask) | (d & ~mask);
+    }
+
+    template<typename Callback>
+    static void dispatch(uint64_t p, Callback callback) {
+        if (p == 0) {
+            throw invalid_argument("   ");
+        }
+        if (p < (1ULL << 32)) {
+            callback(BarrettModulus(p));
+        }
+        else if (p % 2 == 1) {
+            callback(MontgomeryModulus(p));
+        }
+        else {
+            callback(GenericModulus(p));
+        }
+    }
+
+    //  F(n)   
+    template<typename Modulus>
+    static uint64_t doubling(const Modulus& mod, uint64_t n) {
+        uint64_t a = 0, b = mod.one();
+        for (int bit = bitLength(n) - 1; bit >= 0; bit--) {
+            uint64_t c = mod.mul(a, mod.sub(mod.add(b, b), a));
+            uint64_t d = mod.add(mod.mul(a, a), mod.mul(b, b));
+            select((n >> bit) & 1, c, d, mod.add(c, d), a, b);
+        }
+        return a;
+    }
+
+    template<typename Modulus>
+    static void batchKernel(const Modulus& modulus, const uint64_t* indices, uint64_t* out, size_t count) {
+        //  :   out     
+        const Modulus mod = modulus;
+        size_t i = 0;
+        for (; i + LANES <= count; i += LANES) {
+            uint64_t maxIndex = 0;
+            for (size_t l = 0; l < LANES; l++) maxIndex = max(maxIndex, indices[i + l]);
+
+            //       (F0, F1)  
+            uint64_t a[LANES], b[LANES];
+            for (size_t l = 0; l < LANES; l++) {
+                a[l] = 0;
+                b[l] = mod.one();
+            }
+            for (int bit = bitLength(maxIndex) - 1; bit >= 0; bit--) {
+                for (size_t l = 0; l < LANES; l++) {
+                    uint64_t c = mod.mul(a[l], mod.sub(mod.add(b[l], b[l]), a[l]));
+                    uint64_t d = mod.add(mod.mul(a[l], a[l]), mod.mul(b[l], b[l]));
+                    select((indices[i + l] >> bit) & 1, c, d, mod.add(c, d), a[l], b[l]);
+                }
+            }
+            for (size_t l = 0; l < LANES; l++) out[i + l] = mod.fromDomain(a[l]);
+        }
+        for (; i < count; i++) {
+            out[i] = mod.fromDomain(doubling(mod, indices[i]));
+        }
+    }
+
+    static UInt128 divideBy10(UInt128 value, uint64_t& remainder) {
+#ifdef __SIZEOF_INT128__
+        remainder = (uint64_t)(value % 10);
+        return value / 10;
+#else
+        uint64_t highQuotient = value.high / 10;
+        uint64_t rest = value.high % 10;
+        uint64_t lowQuotient = _udiv128(rest, value.low, 10, &remainder);
+        return UInt128(highQuotient, lowQuotient);
+#endif
+    }
+};
+
+// ====================    ====================
+
+class FastFibonacciBenchmark {
+public:
+    static bool verify() {
+        cout << "===    ===" << endl;
+        bool ok = true;
+
+        //       F(186)
+        for (uint64_t n = 0; n <= FIBONACCI_MAX_EXACT_INDEX && ok; n++) {
+            ok = FastFibonacci::exact(n) == FastFibonacci::fromTable(n);
+        }
+        ok = ok && FastFibonacci::toString(FastFibonacci::exact(186)) ==
+            "332825110087067562321196029789634457848";
+        bool thrown = false;
+        try {
+            FastFibonacci::exact(187);
+        }
+        catch (const out_of_range&) {
+            thrown = true;
+        }
+        ok = ok && thrown;
+
+        //          
+        vector<uint64_t> moduli = { 1, 2, 10, 1000000007ULL, 4294967291ULL,
+            (1ULL << 61) - 1, 18446744073709551557ULL, 1ULL << 40, 998244353ULL * 1000 };
+        mt19937_64 gen(42);
+        for (uint64_t p : moduli) {
+            for (uint64_t n = 0; n <= FIBONACCI_MAX_EXACT_INDEX && ok; n++) {
+                ok = FastFibonacci::modular(n, p) == iterative(n, p);
+            }
+            vector<uint64_t> indices(1001);
+            for (uint64_t& x : indices) x = gen() >> (gen() % 64);
+            vector<uint64_t> batch = FastFibonacci::modularBatch(indices, p);
+            for (size_t i = 0; i < indices.size() && ok; i++) {
+                uint64_t expected = matrixFibonacci(indices[i], p);
+                ok = batch[i] == expected && FastFibonacci::modular(indices[i], p) == expected;
+            }
+        }
+        uint64_t big = FastFibonacci::modular(1000000000000000000ULL, 1000000007ULL);
+        cout << "  F(10^18) mod (10^9 + 7) = " << big << endl;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //    ,   
+    static void compareWithIterative(int count = 10000) {
+        cout << "\n===   : O(n)  O(log n) ===" << endl;
+        const uint64_t p = 1000000007ULL;
+
+        for (uint64_t n : { 1000ULL, 1000000ULL, 10000000ULL }) {
+            auto start = high_resolution_clock::now();
+            uint64_t a = 0, b = 1;
+            for (uint64_t i = 0; i < n; i++) {
+                uint64_t next = (a + b) % p;
+                a = b;
+                b = next;
+            }
+            auto middle = high_resolution_clock::now();
+            uint64_t fast = FastFibonacci::modular(n, p);
+            auto end = high_resolution_clock::now();
+            cout << "  n = " << n << ":  " << duration_cast<microseconds>(middle - start).count()
+                << " ,  " << duration<double, micro>(end - middle).count() << " , "
+                << (a == fast ? "OK" : "") << endl;
+        }
+
+        mt19937_64 gen(1);
+        vector<uint64_t> indices(count);
+        for (uint64_t& x : indices) x = gen() % 1000000000000000000ULL;
+        for (uint64_t modulus : { p, (uint64_t)((1ULL << 61) - 1) }) {
+            auto start = high_resolution_clock::now();
+            uint64_t checksum = 0;
+            for (uint64_t n : indices) checksum += FastFibonacci::modular(n, modulus);
+            auto middle = high_resolution_clock::now();
+            vector<uint64_t> batch = FastFibonacci::modularBatch(indices, modulus);
+            auto end = high_resolution_clock::now();
+            uint64_t batchChecksum = 0;
+            for (uint64_t x : batch) batchChecksum += x;
+            cout << "  " << count << "   10^18   " << modulus << ":  "
+                << duration<double, nano>(middle - start).count() / count << " ,  "
+                << duration<double, nano>(end - middle).count() / count << "   , "
+                << (checksum == batchChecksum ? "OK" : "") << endl;
+        }
+    }
+
+private:
+    // F(n) mod p  
+    static uint64_t iterative(uint64_t n, uint64_t p) {
+        uint64_t a = 0, b = 1 % p;
+        for (uint64_t i = 0; i < n; i++) {
+            uint64_t next = a >= p - b ? a - (p - b) : a + b;
+            a = b;
+            b = next;
+        }
+        return a;
+    }
+
+    // [[1,1],[1,0]]^n    -    
+    static uint64_t matrixFibonacci(uint64_t n, uint64_t p) {
+        uint64_t r00 = 1 % p, r01 = 0, r10 = 0, r11 = 1 % p;
+        uint64_t m00 = 1 % p, m01 = 1 % p, m10 = 1 % p, m11 = 0;
+        auto add = [p](uint64_t a, uint64_t b) { return a >= p - b ? a - (p - b) : a + b; };
+        while (n > 0) {
+            if (n & 1) {
+                uint64_t t00 = add(mulMod64(r00, m00, p), mulMod64(r01, m10, p));
+                uint64_t t01 = add(mulMod64(r00, m01, p), mulMod64(r01, m11, p));
+                uint64_t t10 = add(mulMod64(r10, m00, p), mulMod64(r11, m10, p));
+                uint64_t t11 = add(mulMod64(r10, m01, p), mulMod64(r11, m11, p));
+                r00 = t00; r01 = t01; r10 = t10; r11 = t11;
+            }
+            uint64_t t00 = add(mulMod64(m00, m00, p), mulMod64(m01, m10, p));
+            uint64_t t01 = add(mulMod64(m00, m01, p), mulMod64(m01, m11, p));
+            uint64_t t10 = add(mulMod64(m10, m00, p), mulMod64(m11, m10, p));
+            uint64_t t11 = add(mulMod64(m10, m01, p), mulMod64(m11, m11, p));
+            m00 = t00; m01 = t01; m10 = t10; m11 = t11;
+            n >>= 1;
+        }
+        return r01;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,430 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <barrier>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#ifndef HAS_AVX2
+#define HAS_AVX2 1
+#endif
+#endif
+
+using namespace std;
+using namespace chrono;
+
+// ====================      ====================
+
+// dst |= src << shift   [lo, hi).      
+//   ,  src  dst   (  )
+class BitsetShiftOr {
+public:
+    static void apply(const uint64_t* src, uint64_t* dst, size_t lo, size_t hi, size_t shift) {
+        const size_t wordShift = shift / 64;
+        const unsigned bitShift = (unsigned)(shift % 64);
+        size_t i = hi;
+
+        //  :  i   src[i - wordShift]  src[i - wordShift - 1]
+        const size_t vectorLow = max(lo, wordShift + 1);
+#ifdef HAS_AVX2
+        const __m128i left = _mm_cvtsi32_si128((int)bitShift);
+        const __m128i right = _mm_cvtsi32_si128((int)(64 - bitShift));
+        while (i >= vectorLow + 4) {
+            i -= 4;
+            __m256i high = _mm256_loadu_si256((const __m256i*)(src + i - wordShift));
+            __m256i low = _mm256_loadu_si256((const __m256i*)(src + i - wordShift - 1));
+            __m256i current = _mm256_loadu_si256((const __m256i*)(src + i));
+            __m256i shifted = _mm256_or_si256(_mm256_sll_epi64(high, left), _mm256_srl_epi64(low, right));
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_or_si256(current, shifted));
+        }
+#elif defined(HAS_SSE2)
+        const __m128i left = _mm_cvtsi32_si128((int)bitShift);
+        const __m128i right = _mm_cvtsi32_si128((int)(64 - bitShift));
+        while (i >= vectorLow + 2) {
+            i -= 2;
+            __m128i high = _mm_loadu_si128((const __m128i*)(src + i - wordShift));
+            __m128i low = _mm_loadu_si128((const __m128i*)(src + i - wordShift - 1));
+            __m128i current = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128i shifted = _mm_or_si128(_mm_sll_epi64(high, left), _mm_srl_epi64(low, right));
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(current, shifted));
+        }
+#endif
+        //    ,     
+        while (i > lo) {
+            i--;
+            dst[i] = src[i] | shiftedWord(src, i, wordShift, bitShift);
+        }
+    }
+
+private:
+    static uint64_t shiftedWord(const uint64_t* src, size_t i, size_t wordShift, unsigned bitShift) {
+        if (i < wordShift) return 0;
+        size_t j = i - wordShift;
+        uint64_t value = src[j] << bitShift;
+        if (bitShift != 0 && j > 0) {
+            value |= src[j - 1] >> (64 - bitShift);
+        }
+        return value;
+    }
+};
+
+// ====================      ====================
+
+//  s    -      s.
+//  w   reach |= reach << w: target/64  
+//   target        n + 1
+class BitsetSubsetSum {
+public:
+    enum class Witness {
+        None,              //  
+        History,           //     : n * target / 64 
+        DivideAndConquer   //  : O(target) ,  log n  
+    };
+
+    struct Options {
+        unsigned threads = 1;
+        Witness witness = Witness::None;
+    };
+
+    struct Result {
+        bool reachable = false;
+        vector<size_t> items;   //   nums,    target
+    };
+
+    static bool exists(const vector<int>& nums, int target, unsigned threads = 1) {
+        if (target < 0) return false;
+        vector<uint64_t> reach = reachableSums(nums, 0, nums.size(), target, threads);
+        return testBit(reach, (size_t)target);
+    }
+
+    static Result solve(const vector<int>& nums, int target) {
+        return solve(nums, target, Options());
+    }
+
+    static Result solve(const vector<int>& nums, int target, const Options& options) {
+        validate(nums);
+        Result result;
+        if (target < 0) return result;
+
+        const size_t words = wordCount(target);
+        if (options.witness == Witness::History) {
+            // history[i] - ,   i + 1 
+            vector<uint64_t> history(nums.size() * words);
+            vector<uint64_t> reach(words);
+            reach[0] = 1;
+            for (size_t i = 0; i < nums.size(); i++) {
+                if (nums[i] > 0 && nums[i] <= target) {
+                    BitsetShiftOr::apply(reach.data(), reach.data(), 0, words, (size_t)nums[i]);
+                }
+                copy(reach.begin(), reach.end(), history.begin() + i * words);
+            }
+            result.reachable = testBit(reach, (size_t)target);
+            if (!result.reachable) return result;
+
+            size_t sum = (size_t)target;
+            for (size_t i = nums.size(); i-- > 0 && sum > 0;) {
+                bool withoutItem = i == 0 ? sum == 0 : testBit(history.data() + (i - 1) * words, sum);
+                if (!withoutItem) {
+                    result.items.push_back(i);
+                    sum -= (size_t)nums[i];
+                }
+            }
+            reverse(result.items.begin(), result.items.end());
+            return result;
+        }
+
+        vector<uint64_t> reach = reachableSums(nums, 0, nums.size(), target, options.threads);
+        result.reachable = testBit(reach, (size_t)target);
+        if (result.reachable && options.witness == Witness::DivideAndConquer) {
+            reconstruct(nums, 0, nums.size(), target, options.threads, result.items);
+            sort(result.items.begin(), result.items.end());
+        }
+        return result;
+    }
+
+    //     limit,   [from, to)
+    static vector<uint64_t> reachableSums(const vector<int>& nums, size_t from, size_t to,
+        int limit, unsigned threads = 1) {
+        validate(nums);
+        const size_t words = wordCount(limit);
+        vector<uint64_t> reach(words);
+        reach[0] = 1;
+
+        //      :    
+        threads = max(1u, min(threads, (unsigned)(words / MIN_WORDS_PER_THREAD)));
+        if (threads == 1) {
+            size_t active = 1;
+            for (size_t i = from; i < to; i++) {
+                if (nums[i] <= 0 || nums[i] > limit) continue;
+                active = min(words, active + (size_t)nums[i] / 64 + 1);
+                BitsetShiftOr::apply(reach.data(), reach.data(), 0, active, (size_t)nums[i]);
+            }
+        }
+        else {
+            reach = parallelReach(nums, from, to, limit, threads, move(reach));
+        }
+        clearTail(reach, limit);
+        return reach;
+    }
+
+private:
+    static constexpr size_t MIN_WORDS_PER_THREAD = 1 << 12;
+
+    static void validate(const vector<int>& nums) {
+        for (int x : nums) {
+            if (x < 0) {
+                throw invalid_argument(" :    ");
+            }
+        }
+    }
+
+    static size_t wordCount(int limit) {
+        return (size_t)limit / 64 + 1;
+    }
+
+    static bool testBit(const vector<uint64_t>& bits, size_t index) {
+        return testBit(bits.data(), index);
+    }
+
+    static bool testBit(const uint64_t* bits, size_t index) {
+        return (bits[index / 64] >> (index % 64)) & 1;
+    }
+
+    static void clearTail(vector<uint64_t>& bits, int limit) {
+        unsigned used = (unsigned)((size_t)limit % 64) + 1;
+        if (used < 64) bits.back() &= (1ULL << used) - 1;
+    }
+
+    //  :         next,
+    //   cur,     
+    static vector<uint64_t> parallelReach(const vector<int>& nums, size_t from, size_t to,
+        int limit, unsigned threads, vector<uint64_t> initial) {
+        const size_t words = initial.size();
+        vector<uint64_t> cur = move(initial);
+        vector<uint64_t> next(words);
+
+        vector<size_t> items;
+        for (size_t i = from; i < to; i++) {
+            if (nums[i] > 0 && nums[i] <= limit) items.push_back(i);
+        }
+        if (items.empty()) return cur;
+
+        size_t step = 0;
+        size_t active = min(words, (size_t)nums[items[0]] / 64 + 2);
+        auto onStepDone = [&]() noexcept {
+            swap(cur, next);
+            step++;
+            if (step < items.size()) {
+                active = min(words, active + (size_t)nums[items[step]] / 64 + 1);
+            }
+        };
+        barrier sync((ptrdiff_t)threads, onStepDone);
+
+        auto worker = [&](unsigned t) {
+            while (step < items.size()) {
+                size_t lo = active * t / threads;
+                size_t hi = active * (t + 1) / threads;
+                BitsetShiftOr::apply(cur.data(), next.data(), lo, hi, (size_t)nums[items[step]]);
+                sync.arrive_and_wait();
+            }
+        };
+
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(worker, t);
+        }
+        worker(0);
+        for (thread& th : pool) th.join();
+        return cur;
+    }
+
+    //   ,       
+    // target = s + (target - s),  ;  
+    static void reconstruct(const vector<int>& nums, size_t lo, size_t hi, int target,
+        unsigned threads, vector<size_t>& items) {
+        if (target == 0) return;
+        if (hi - lo == 1) {
+            items.push_back(lo);  // target > 0   
+            return;
+        }
+        size_t mid = lo + (hi - lo) / 2;
+        vector<uint64_t> left = reachableSums(nums, lo, mid, target, threads);
+        vector<uint64_t> right = reachableSums(nums, mid, hi, target, threads);
+
+        int split = -1;
+        for (size_t w = 0; w < left.size() && split < 0; w++) {
+            for (uint64_t bits = left[w]; bits != 0; bits &= bits - 1) {
+                int s = (int)(w * 64 + lowestBit(bits));
+                if (s > target) break;
+                if (testBit(right, (size_t)(target - s))) {
+                    split = s;
+                    break;
+                }
+            }
+        }
+        if (split < 0) {
+            throw logic_error(" :   ");
+        }
+        right.clear();
+        right.shrink_to_fit();
+        left.clear();
+        left.shrink_to_fit();
+
+        reconstruct(nums, lo, mid, split, threads, items);
+        reconstruct(nums, mid, hi, target - split, threads, items);
+    }
+
+    static unsigned lowestBit(uint64_t x) {
+        unsigned index = 0;
+        while ((x & 1) == 0) {
+            x >>= 1;
+            index++;
+        }
+        return index;
+    }
+};
+
+// ====================    ====================
+
+class BitsetSubsetSumBenchmark {
+public:
+    static bool verify() {
+        cout << "===       ===" << endl;
+        bool ok = true;
+        mt19937 gen(5);
+
+        //          
+        for (size_t shift = 0; shift < 300 && ok; shift++) {
+            vector<uint64_t> bits(13);
+            for (uint64_t& w : bits) w = ((uint64_t)gen() << 32) | gen();
+            vector<uint64_t> expected = bits;
+            for (size_t b = 0; b < 13 * 64; b++) {
+                if (b >= shift && ((bits[(b - shift) / 64] >> ((b - shift) % 64)) & 1)) {
+                    expected[b / 64] |= 1ULL << (b % 64);
+                }
+            }
+            vector<uint64_t> inPlace = bits;
+            BitsetShiftOr::apply(inPlace.data(), inPlace.data(), 0, 13, shift);
+            vector<uint64_t> separate(13);
+            BitsetShiftOr::apply(bits.data(), separate.data(), 0, 6, shift);
+            BitsetShiftOr::apply(bits.data(), separate.data(), 6, 13, shift);
+            ok = inPlace == expected && separate == expected;
+        }
+
+        //      
+        for (int trial = 0; trial < 300 && ok; trial++) {
+            int n = 1 + (int)(gen() % 25);
+            vector<int> nums(n);
+            for (int& x : nums) x = (int)(gen() % 400);
+            int target = (int)(gen() % 3000);
+            bool expected = tableDp(nums, target);
+
+            for (Witness witness : { Witness::None, Witness::History, Witness::DivideAndConquer }) {
+                BitsetSubsetSum::Options options;
+                options.witness = witness;
+                options.threads = trial % 2 == 0 ? 1 : 3;
+                BitsetSubsetSum::Result result = BitsetSubsetSum::solve(nums, target, options);
+                ok = ok && result.reachable == expected;
+                if (ok && expected && witness != Witness::None) {
+                    ok = checkWitness(nums, target, result.items);
+                }
+            }
+        }
+
+        //  ,   
+        vector<int> nums(300);
+        for (int& x : nums) x = 1000 + (int)(gen() % 50000);
+        int target = 2000003;
+        bool single = BitsetSubsetSum::exists(nums, target, 1);
+        bool parallel = BitsetSubsetSum::exists(nums, target, 4);
+        ok = ok && single == parallel;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    static void compareWithTable() {
+        cout << "\n===  : vector<vector<bool>>    ===" << endl;
+        mt19937 gen(11);
+
+        for (auto [n, target] : { pair<int, int>{ 100, 10000 }, pair<int, int>{ 300, 100000 } }) {
+            vector<int> nums(n);
+            for (int& x : nums) x = 1 + (int)(gen() % (2 * target / n));
+            auto start = high_resolution_clock::now();
+            bool expected = tableDp(nums, target);
+            auto middle = high_resolution_clock::now();
+            bool fast = BitsetSubsetSum::exists(nums, target);
+            auto end = high_resolution_clock::now();
+            cout << "  n = " << n << ", target = " << target << ":  "
+                << duration_cast<milliseconds>(middle - start).count() << " ,   "
+                << duration<double, milli>(end - middle).count() << " , "
+                << (expected == fast ? "OK" : "") << endl;
+        }
+
+        //   :    n * target  = 1.25 
+        int n = 10000, target = 1000000;
+        vector<int> nums(n);
+        for (int& x : nums) x = 1 + (int)(gen() % 200000);
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        for (unsigned t : { 1u, threads }) {
+            auto start = high_resolution_clock::now();
+            bool reachable = BitsetSubsetSum::exists(nums, target, t);
+            auto end = high_resolution_clock::now();
+            cout << "  n = " << n << ", target = " << target << ",  " << t << ": "
+                << duration_cast<milliseconds>(end - start).count() << " , "
+                << (reachable ? "" : "") << endl;
+            if (threads == 1) break;
+        }
+
+        BitsetSubsetSum::Options options;
+        options.witness = BitsetSubsetSum::Witness::DivideAndConquer;
+        vector<int> part(nums.begin(), nums.begin() + 2000);
+        auto start = high_resolution_clock::now();
+        BitsetSubsetSum::Result result = BitsetSubsetSum::solve(part, target, options);
+        auto end = high_resolution_clock::now();
+        cout << "   (n = 2000,   ): "
+            << duration_cast<milliseconds>(end - start).count() << " ,  "
+            << result.items.size() << ", " << (result.reachable && checkWitness(part, target, result.items)
+                ? "OK" : "") << endl;
+    }
+
+private:
+    using Witness = BitsetSubsetSum::Witness;
+
+    //   ComplexityClasses::subsetSum - 
+    static bool tableDp(const vector<int>& nums, int target) {
+        int n = (int)nums.size();
+        vector<vector<bool>> dp(n + 1, vector<bool>(target + 1, false));
+        for (int i = 0; i <= n; i++) dp[i][0] = true;
+        for (int i = 1; i <= n; i++) {
+            for (int j = 1; j <= target; j++) {
+                dp[i][j] = dp[i - 1][j] || (j >= nums[i - 1] && dp[i - 1][j - nums[i - 1]]);
+            }
+        }
+        return dp[n][target];
+    }
+
+    static bool checkWitness(const vector<int>& nums, int target, const vector<size_t>& items) {
+        long long sum = 0;
+        for (size_t i = 0; i < items.size(); i++) {
+            if (items[i] >= nums.size() || (i > 0 && items[i] <= items[i - 1])) return false;
+            sum += nums[items[i]];
+        }
+        return sum == target;
+    }
+};
\ No newline at end of file
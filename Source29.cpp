@@ -0,0 +1,415 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <optional>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+
+//  n <= 60     10^15  ,    
+// :      (2^(n/2) ),
+//        .
+//    :   x  
+// merge(L, L + x),      O(1)  
+class MeetInTheMiddle {
+public:
+    static constexpr size_t MAX_ITEMS = 60;
+
+    struct SubsetResult {
+        bool found = false;
+        long long sum = 0;
+        vector<size_t> items;   //   
+    };
+
+    struct KnapsackResult {
+        long long value = 0;
+        long long weight = 0;
+        vector<size_t> items;
+    };
+
+    //       target
+    static SubsetResult subsetSum(const vector<long long>& values, long long target,
+        unsigned threads = 1) {
+        SubsetResult result = closestNotExceeding(values, target, threads);
+        if (result.sum != target) {
+            return SubsetResult();
+        }
+        return result;
+    }
+
+    //   ,   target
+    static SubsetResult closestNotExceeding(const vector<long long>& values, long long target,
+        unsigned threads = 1) {
+        checkSize(values.size());
+        size_t mid = values.size() / 2;
+        vector<long long> left(values.begin(), values.begin() + mid);
+        vector<long long> right(values.begin() + mid, values.end());
+
+        //    ,   target   
+        bool nonNegative = all_of(values.begin(), values.end(), [](long long v) { return v >= 0; });
+        optional<long long> cap = nonNegative ? optional<long long>(target) : nullopt;
+
+        vector<long long> leftSums, rightSums;
+        runHalves(threads,
+            [&](unsigned t) { leftSums = sortedSums(left, cap, t); },
+            [&](unsigned t) { rightSums = sortedSums(right, cap, t); });
+
+        //   ,   
+        SubsetResult result;
+        long long bestLeft = 0, bestRight = 0;
+        size_t j = rightSums.size();
+        for (long long a : leftSums) {
+            while (j > 0 && a + rightSums[j - 1] > target) j--;
+            if (j == 0) break;
+            long long sum = a + rightSums[j - 1];
+            if (!result.found || sum > result.sum) {
+                result.found = true;
+                result.sum = sum;
+                bestLeft = a;
+                bestRight = rightSums[j - 1];
+                if (sum == target) break;
+            }
+        }
+        if (!result.found) return result;
+
+        result.items = findSubset(left, bestLeft, 0);
+        vector<size_t> rightItems = findSubset(right, bestRight, mid);
+        result.items.insert(result.items.end(), rightItems.begin(), rightItems.end());
+        return result;
+    }
+
+    //  0/1:      - 
+    // (  -   ),    
+    static KnapsackResult knapsack(const vector<long long>& weights, const vector<long long>& values,
+        long long capacity, unsigned threads = 1) {
+        if (weights.size() != values.size()) {
+            throw invalid_argument("     ");
+        }
+        checkSize(weights.size());
+        for (size_t i = 0; i < weights.size(); i++) {
+            if (weights[i] < 0 || values[i] < 0) {
+                throw invalid_argument("     ");
+            }
+        }
+        KnapsackResult result;
+        if (capacity < 0) return result;
+
+        size_t mid = weights.size() / 2;
+        vector<Item> left, right;
+        for (size_t i = 0; i < weights.size(); i++) {
+            (i < mid ? left : right).push_back({ weights[i], values[i] });
+        }
+
+        vector<Item> leftFront, rightFront;
+        runHalves(threads,
+            [&](unsigned) { leftFront = paretoFront(left, capacity); },
+            [&](unsigned) { rightFront = paretoFront(right, capacity); });
+
+        //       :     
+        //  -      
+        Item bestLeft{ 0, 0 }, bestRight{ 0, 0 };
+        size_t j = rightFront.size();
+        for (const Item& a : leftFront) {
+            while (j > 0 && a.weight + rightFront[j - 1].weight > capacity) j--;
+            if (j == 0) break;
+            long long value = a.value + rightFront[j - 1].value;
+            if (value > result.value) {
+                result.value = value;
+                bestLeft = a;
+                bestRight = rightFront[j - 1];
+            }
+        }
+
+        result.weight = bestLeft.weight + bestRight.weight;
+        result.items = findItems(left, bestLeft, 0);
+        vector<size_t> rightItems = findItems(right, bestRight, mid);
+        result.items.insert(result.items.end(), rightItems.begin(), rightItems.end());
+        return result;
+    }
+
+    //     ;   cap -    cap
+    static vector<long long> sortedSums(const vector<long long>& values, optional<long long> cap,
+        unsigned threads = 1) {
+        vector<long long> sums = { 0 };
+        vector<long long> buffer;
+        for (long long x : values) {
+            size_t keep = sums.size();
+            if (cap) {
+                keep = upper_bound(sums.begin(), sums.end(), *cap - x) - sums.begin();
+            }
+            buffer.resize(sums.size() + keep);
+            mergeShifted(sums, keep, x, buffer, threads);
+            swap(sums, buffer);
+        }
+        return sums;
+    }
+
+private:
+    struct Item {
+        long long weight;
+        long long value;
+    };
+
+    //      
+    static constexpr size_t PARALLEL_MERGE_MIN = 1 << 16;
+
+    static void checkSize(size_t n) {
+        if (n > MAX_ITEMS) {
+            throw invalid_argument(" :   " + to_string(MAX_ITEMS) + " ");
+        }
+    }
+
+    template<typename Left, typename Right>
+    static void runHalves(unsigned threads, Left left, Right right) {
+        if (threads < 2) {
+            left(1u);
+            right(1u);
+            return;
+        }
+        unsigned leftThreads = threads / 2;
+        thread worker([&]() { left(leftThreads); });
+        right(threads - leftThreads);
+        worker.join();
+    }
+
+    // out = merge(a[0..na), a[0..nb) + x).     
+    //   ,       
+    static void mergeShifted(const vector<long long>& a, size_t nb, long long x,
+        vector<long long>& out, unsigned threads) {
+        const size_t na = a.size();
+        const size_t total = na + nb;
+
+        auto mergeRange = [&](size_t from, size_t to) {
+            //   from: i  a, from - i   
+            size_t lo = from > nb ? from - nb : 0;
+            size_t hi = min(from, na);
+            while (lo < hi) {
+                size_t i = lo + (hi - lo) / 2;
+                if (a[i] <= a[from - i - 1] + x) lo = i + 1;
+                else hi = i;
+            }
+            size_t i = lo, j = from - lo;
+            for (size_t k = from; k < to; k++) {
+                if (j >= nb || (i < na && a[i] <= a[j] + x)) out[k] = a[i++];
+                else out[k] = a[j++] + x;
+            }
+        };
+
+        if (threads < 2 || total < PARALLEL_MERGE_MIN) {
+            mergeRange(0, total);
+            return;
+        }
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(mergeRange, total * t / threads, total * (t + 1) / threads);
+        }
+        mergeRange(0, total / threads);
+        for (thread& th : pool) th.join();
+    }
+
+    // -  (, )     capacity
+    static vector<Item> paretoFront(const vector<Item>& items, long long capacity) {
+        vector<Item> front = { { 0, 0 } };
+        vector<Item> merged;
+        for (const Item& item : items) {
+            if (item.weight > capacity) continue;
+            merged.clear();
+            merged.reserve(front.size() * 2);
+            size_t i = 0, j = 0;
+            while (i < front.size() || j < front.size()) {
+                Item next;
+                bool takeShifted = j < front.size() &&
+                    front[j].weight + item.weight <= capacity &&
+                    (i >= front.size() || front[j].weight + item.weight < front[i].weight);
+                if (takeShifted) {
+                    next = { front[j].weight + item.weight, front[j].value + item.value };
+                    j++;
+                }
+                else if (i < front.size()) {
+                    next = front[i++];
+                }
+                else {
+                    break;  //    
+                }
+                //   (     ) 
+                if (!merged.empty() && next.value <= merged.back().value) continue;
+                if (!merged.empty() && next.weight == merged.back().weight) {
+                    merged.back() = next;
+                }
+                else {
+                    merged.push_back(next);
+                }
+            }
+            swap(front, merged);
+        }
+        return front;
+    }
+
+    //     :    
+    //      ,     O(1)
+    //     (    )
+    template<typename Matches, typename Step>
+    static vector<size_t> grayCodeSearch(size_t count, size_t offset, Matches matches, Step step) {
+        vector<size_t> chosen;
+        uint64_t mask = 0;
+        if (!matches()) {
+            for (uint64_t k = 1; k < (1ULL << count); k++) {
+                unsigned bit = 0;
+                while (((k >> bit) & 1) == 0) bit++;
+                mask ^= 1ULL << bit;
+                step(bit, ((mask >> bit) & 1) != 0);
+                if (matches()) break;
+            }
+        }
+        for (size_t i = 0; i < count; i++) {
+            if ((mask >> i) & 1) chosen.push_back(offset + i);
+        }
+        return chosen;
+    }
+
+    static vector<size_t> findSubset(const vector<long long>& values, long long sum, size_t offset) {
+        long long current = 0;
+        return grayCodeSearch(values.size(), offset,
+            [&]() { return current == sum; },
+            [&](unsigned bit, bool added) { current += added ? values[bit] : -values[bit]; });
+    }
+
+    static vector<size_t> findItems(const vector<Item>& items, const Item& target, size_t offset) {
+        long long weight = 0, value = 0;
+        return grayCodeSearch(items.size(), offset,
+            [&]() { return weight == target.weight && value == target.value; },
+            [&](unsigned bit, bool added) {
+                long long sign = added ? 1 : -1;
+                weight += sign * items[bit].weight;
+                value += sign * items[bit].value;
+            });
+    }
+};
+
+// ====================    ====================
+
+class MeetInTheMiddleBenchmark {
+public:
+    static bool verify() {
+        cout << "===    ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(3);
+
+        for (int trial = 0; trial < 400 && ok; trial++) {
+            int n = (int)(gen() % 15);
+            bool negative = trial % 4 == 3;
+            long long range = trial % 2 == 0 ? 1000000000000000LL : 50;
+            vector<long long> values(n), weights(n);
+            for (int i = 0; i < n; i++) {
+                values[i] = (long long)(gen() % range) - (negative ? range / 2 : 0);
+                weights[i] = (long long)(gen() % range);
+            }
+            long long target = n == 0 ? 0 : (long long)(gen() % (range * n / 2 + 1));
+            unsigned threads = trial % 3 == 0 ? 4 : 1;
+
+            //   
+            optional<long long> best;
+            long long bestValue = 0;
+            long long capacity = n == 0 ? 0 : (long long)(gen() % (range * n / 2 + 1));
+            for (uint64_t mask = 0; mask < (1ULL << n); mask++) {
+                long long sum = 0, weight = 0, value = 0;
+                for (int i = 0; i < n; i++) {
+                    if ((mask >> i) & 1) {
+                        sum += values[i];
+                        weight += weights[i];
+                        value += values[i];
+                    }
+                }
+                if (sum <= target && (!best || sum > *best)) best = sum;
+                if (!negative && weight <= capacity) bestValue = max(bestValue, value);
+            }
+
+            auto closest = MeetInTheMiddle::closestNotExceeding(values, target, threads);
+            ok = closest.found == best.has_value() && (!best || closest.sum == *best);
+            ok = ok && (!closest.found || sumOf(values, closest.items) == closest.sum);
+            auto exact = MeetInTheMiddle::subsetSum(values, target, threads);
+            ok = ok && exact.found == (best && *best == target);
+
+            if (ok && !negative) {
+                auto knap = MeetInTheMiddle::knapsack(weights, values, capacity, threads);
+                ok = knap.value == bestValue && sumOf(values, knap.items) == knap.value &&
+                    sumOf(weights, knap.items) == knap.weight && knap.weight <= capacity;
+            }
+        }
+
+        //     
+        vector<long long> values(22);
+        for (long long& v : values) v = (long long)(gen() % 1000000000000000LL);
+        ok = ok && MeetInTheMiddle::sortedSums(values, nullopt, 1) ==
+            MeetInTheMiddle::sortedSums(values, nullopt, 4);
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //       
+    static void compareWithSorting(int n = 44) {
+        cout << "\n===  : n = " << n << ",   10^15 ===" << endl;
+        mt19937_64 gen(17);
+        vector<long long> values(n), weights(n);
+        for (int i = 0; i < n; i++) {
+            values[i] = 1 + (long long)(gen() % 1000000000000000LL);
+            weights[i] = 1 + (long long)(gen() % 1000000000000000LL);
+        }
+        long long total = 0;
+        for (long long v : values) total += v;
+        long long target = total / 3;
+
+        vector<long long> half(values.begin(), values.begin() + n / 2);
+        auto start = high_resolution_clock::now();
+        vector<long long> merged = MeetInTheMiddle::sortedSums(half, nullopt);
+        auto middle = high_resolution_clock::now();
+        vector<long long> sorted = sortedBySort(half);
+        auto end = high_resolution_clock::now();
+        cout << "    (2^" << n / 2 << "):  "
+            << duration_cast<milliseconds>(middle - start).count() << " ,  + sort "
+            << duration_cast<milliseconds>(end - middle).count() << " , "
+            << (merged == sorted ? "OK" : "") << endl;
+
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        start = high_resolution_clock::now();
+        auto closest = MeetInTheMiddle::closestNotExceeding(values, target, threads);
+        end = high_resolution_clock::now();
+        cout << "      target: " << duration_cast<milliseconds>(end - start).count()
+            << " ,  " << target - closest.sum << ", "
+            << (sumOf(values, closest.items) == closest.sum ? "OK" : "") << endl;
+
+        start = high_resolution_clock::now();
+        auto knap = MeetInTheMiddle::knapsack(weights, values, total / 3, threads);
+        end = high_resolution_clock::now();
+        cout << "  : " << duration_cast<milliseconds>(end - start).count() << " ,  "
+            << knap.value << ",  " << knap.items.size() << ", "
+            << (sumOf(values, knap.items) == knap.value ? "OK" : "") << endl;
+    }
+
+private:
+    static long long sumOf(const vector<long long>& values, const vector<size_t>& items) {
+        long long sum = 0;
+        for (size_t i : items) sum += values[i];
+        return sum;
+    }
+
+    static vector<long long> sortedBySort(const vector<long long>& values) {
+        vector<long long> sums(1ULL << values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            size_t size = 1ULL << i;
+            for (size_t k = 0; k < size; k++) sums[size + k] = sums[k] + values[i];
+        }
+        sort(sums.begin(), sums.end());
+        return sums;
+    }
+};
\ No newline at end of file
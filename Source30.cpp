@@ -0,0 +1,520 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <limits>
+#include <numeric>
+#include <cmath>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace std;
+using namespace chrono;
+
+// ==================== - ====================
+
+//  TSP   : dp[S][j] -   
+//   0    S    j. O(2^n * n^2)   n!.
+//
+// :    (S, j)  j  S,    S, 
+//  - n/2 * 2^n  Cost (int32_t  float)  
+//   S.      :  
+//   ,      .
+//
+//      ,     
+//       
+template<typename Cost = int32_t>
+class HeldKarpSolver {
+public:
+    static_assert(is_same_v<Cost, int32_t> || is_same_v<Cost, float>,
+        "   int32_t  float");
+
+    static constexpr int MAX_CITIES = 26;
+    static constexpr Cost INF = numeric_limits<Cost>::max() / 2;
+
+    struct Options {
+        unsigned threads = 1;
+        bool branchAndBound = false;
+    };
+
+    struct Result {
+        Cost length = 0;
+        vector<int> tour;           //    0
+        uint64_t states = 0;        //   (S, j)
+        uint64_t pruned = 0;        //   
+    };
+
+    static Result solve(const vector<vector<int>>& graph) {
+        return solve(graph, Options());
+    }
+
+    static Result solve(const vector<vector<int>>& graph, const Options& options) {
+        const int n = (int)graph.size();
+        if (n == 0) {
+            throw invalid_argument(" ");
+        }
+        if (n > MAX_CITIES) {
+            throw invalid_argument("-:   " + to_string(MAX_CITIES) + " ");
+        }
+        long long maxEdge = 0;
+        for (const vector<int>& row : graph) {
+            if ((int)row.size() != n) {
+                throw invalid_argument("    ");
+            }
+            for (int d : row) {
+                if (d < 0) throw invalid_argument("   ");
+                maxEdge = max(maxEdge, (long long)d);
+            }
+        }
+        if (is_integral_v<Cost> && maxEdge * n >= (long long)INF) {
+            throw overflow_error("      int32_t");
+        }
+
+        Result result;
+        if (n == 1) {
+            result.tour = { 0 };
+            return result;
+        }
+
+        Solver solver(graph, options);
+        solver.run();
+        solver.extract(result);
+        return result;
+    }
+
+private:
+    //  c (1..n-1) -  c-1 ;  0 -       
+    class Solver {
+    public:
+        Solver(const vector<vector<int>>& graph, const Options& options)
+            : n((int)graph.size()), m(n - 1), options(options) {
+            dist.resize((size_t)n * n);
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) dist[(size_t)i * n + j] = (Cost)graph[i][j];
+            }
+
+            //  S -     
+            const size_t masks = (size_t)1 << m;
+            offset.resize(masks + 1);
+            offset[0] = 0;
+            for (size_t mask = 0; mask < masks; mask++) {
+                offset[mask + 1] = offset[mask] + (uint32_t)popcount32((uint32_t)mask);
+            }
+            dp.assign(offset[masks], INF);
+
+            for (int k = 0; k <= m; k++) {
+                binomial[k][0] = 1;
+                for (int r = 1; r <= k; r++) {
+                    binomial[k][r] = binomial[k - 1][r - 1] + (r <= k - 1 ? binomial[k - 1][r] : 0);
+                }
+            }
+
+            if (options.branchAndBound) {
+                upperBound = heuristicTour();
+                //       0       
+                minIn.assign(n, INF);
+                secondMin.assign(n, INF);
+                symmetric = true;
+                for (int j = 0; j < n; j++) {
+                    for (int i = 0; i < n; i++) {
+                        if (i == j) continue;
+                        symmetric = symmetric && at(i, j) == at(j, i);
+                        Cost d = at(i, j);
+                        if (d < minIn[j]) {
+                            secondMin[j] = minIn[j];
+                            minIn[j] = d;
+                        }
+                        else if (d < secondMin[j]) {
+                            secondMin[j] = d;
+                        }
+                    }
+                }
+                //  n = 2     
+                if (n < 3) symmetric = false;
+                maskMin.assign(masks, INF);
+                maskMin[0] = 0;
+            }
+        }
+
+        void run() {
+            //  1:  0 -> j
+            for (int j = 0; j < m; j++) {
+                uint32_t mask = 1u << j;
+                dp[offset[mask]] = at(0, j + 1);
+                states++;
+                if (options.branchAndBound) {
+                    if (dp[offset[mask]] + boundFor(remainingBound(mask), j) > upperBound) {
+                        dp[offset[mask]] = INF;
+                        pruned++;
+                    }
+                    else {
+                        maskMin[mask] = dp[offset[mask]];
+                    }
+                }
+            }
+
+            for (int k = 2; k <= m; k++) {
+                uint64_t count = binomial[m][k];
+                unsigned threads = (unsigned)max<uint64_t>(1, min<uint64_t>(options.threads, count / 256));
+                if (threads == 1) {
+                    computeRange(k, 0, count, states, pruned);
+                    continue;
+                }
+                vector<uint64_t> threadStates(threads), threadPruned(threads);
+                vector<thread> pool;
+                for (unsigned t = 0; t < threads; t++) {
+                    pool.emplace_back([&, t]() {
+                        computeRange(k, count * t / threads, count * (t + 1) / threads,
+                            threadStates[t], threadPruned[t]);
+                        });
+                }
+                for (thread& th : pool) th.join();
+                for (unsigned t = 0; t < threads; t++) {
+                    states += threadStates[t];
+                    pruned += threadPruned[t];
+                }
+            }
+        }
+
+        void extract(Result& result) {
+            const uint32_t full = ((uint32_t)1 << m) - 1;
+            Cost best = INF;
+            int last = -1;
+            for (int j = 0; j < m; j++) {
+                Cost value = dp[offset[full] + rankOf(full, j)];
+                if (value >= INF) continue;
+                Cost total = value + at(j + 1, 0);
+                if (total < best) {
+                    best = total;
+                    last = j;
+                }
+            }
+            if (last < 0) {
+                throw logic_error("-:   ");
+            }
+
+            //  :     
+            vector<int> reversed;
+            uint32_t mask = full;
+            int j = last;
+            while (true) {
+                reversed.push_back(j + 1);
+                uint32_t previous = mask ^ (1u << j);
+                if (previous == 0) break;
+                Cost target = dp[offset[mask] + rankOf(mask, j)];
+                int from = -1;
+                Cost closest = INF;
+                for (uint32_t bits = previous; bits != 0; bits &= bits - 1) {
+                    int i = lowestBit(bits);
+                    Cost candidate = dp[offset[previous] + rankOf(previous, i)];
+                    if (candidate >= INF) continue;
+                    Cost value = candidate + at(i + 1, j + 1);
+                    //  float  ,     
+                    Cost error = value > target ? value - target : target - value;
+                    if (from < 0 || error < closest) {
+                        closest = error;
+                        from = i;
+                    }
+                }
+                mask = previous;
+                j = from;
+            }
+            result.tour = { 0 };
+            result.tour.insert(result.tour.end(), reversed.rbegin(), reversed.rend());
+            result.length = best;
+            result.states = states;
+            result.pruned = pruned;
+        }
+
+    private:
+        int n;
+        int m;
+        Options options;
+        vector<Cost> dist;
+        vector<uint32_t> offset;
+        vector<Cost> dp;
+        uint64_t binomial[MAX_CITIES][MAX_CITIES] = {};
+        uint64_t states = 0;
+        uint64_t pruned = 0;
+
+        Cost upperBound = INF;
+        vector<Cost> minIn;
+        vector<Cost> secondMin;
+        bool symmetric = false;
+        vector<Cost> maskMin;       //     , INF -  
+
+        static int popcount32(uint32_t x) {
+            int count = 0;
+            for (; x != 0; x &= x - 1) count++;
+            return count;
+        }
+
+        static int lowestBit(uint32_t x) {
+            int index = 0;
+            while ((x & 1) == 0) {
+                x >>= 1;
+                index++;
+            }
+            return index;
+        }
+
+        static uint32_t rankOf(uint32_t mask, int bit) {
+            return (uint32_t)popcount32(mask & ((1u << bit) - 1));
+        }
+
+        Cost at(int from, int to) const {
+            return dist[(size_t)from * n + to];
+        }
+
+        //    rank  k-   
+        uint32_t unrank(uint64_t rank, int k) const {
+            uint32_t mask = 0;
+            int c = m - 1;
+            for (int i = k; i >= 1; i--) {
+                while (binomial[c][i] > rank) c--;
+                mask |= 1u << c;
+                rank -= binomial[c][i];
+                c--;
+            }
+            return mask;
+        }
+
+        //        ( )
+        static uint32_t nextMask(uint32_t mask) {
+            uint32_t lowest = mask & (0u - mask);
+            uint32_t ripple = mask + lowest;
+            return (((ripple ^ mask) >> 2) / lowest) | ripple;
+        }
+
+        //     j -> (  mask) -> 0.   
+        //         0.   
+        //       ,     
+        //         
+        struct RemainingBound {
+            Cost inSum = 0;
+            Cost twoSum = 0;
+        };
+
+        RemainingBound remainingBound(uint32_t mask) const {
+            RemainingBound bound;
+            for (int c = 0; c < m; c++) {
+                if (!((mask >> c) & 1)) {
+                    bound.inSum += minIn[c + 1];
+                    bound.twoSum += minIn[c + 1] + secondMin[c + 1];
+                }
+            }
+            return bound;
+        }
+
+        Cost boundFor(const RemainingBound& bound, int j) const {
+            Cost result = bound.inSum + minIn[0];
+            if (symmetric) {
+                Cost twoEdges = (bound.twoSum + minIn[j + 1] + minIn[0]) / 2;
+                result = max(result, twoEdges);
+            }
+            return result;
+        }
+
+        void computeRange(int k, uint64_t from, uint64_t to, uint64_t& statesOut, uint64_t& prunedOut) {
+            if (from >= to) return;
+            uint32_t mask = unrank(from, k);
+            RemainingBound remaining;
+            for (uint64_t r = from; r < to; r++, mask = r < to ? nextMask(mask) : mask) {
+                Cost* entry = dp.data() + offset[mask];
+                if (options.branchAndBound) remaining = remainingBound(mask);
+                Cost minimum = INF;
+                int rank = 0;
+                for (uint32_t bits = mask; bits != 0; bits &= bits - 1, rank++) {
+                    int j = lowestBit(bits);
+                    uint32_t previous = mask ^ (1u << j);
+                    statesOut++;
+                    Cost bound = options.branchAndBound ? boundFor(remaining, j) : 0;
+                    //     previous      j
+                    //     -    
+                    if (options.branchAndBound &&
+                        (maskMin[previous] >= INF || maskMin[previous] + minIn[j + 1] + bound > upperBound)) {
+                        prunedOut++;
+                        continue;
+                    }
+
+                    const Cost* prevEntry = dp.data() + offset[previous];
+                    Cost best = INF;
+                    int prevRank = 0;
+                    for (uint32_t pbits = previous; pbits != 0; pbits &= pbits - 1, prevRank++) {
+                        int i = lowestBit(pbits);
+                        Cost candidate = prevEntry[prevRank] + at(i + 1, j + 1);
+                        if (candidate < best) best = candidate;
+                    }
+                    if (options.branchAndBound && best < INF && best + bound > upperBound) {
+                        prunedOut++;
+                        continue;
+                    }
+                    entry[rank] = best < INF ? best : INF;
+                    minimum = min(minimum, entry[rank]);
+                }
+                if (options.branchAndBound) maskMin[mask] = minimum;
+            }
+        }
+
+        //  :     2-opt
+        Cost heuristicTour() const {
+            vector<int> tour = { 0 };
+            vector<bool> used(n, false);
+            used[0] = true;
+            for (int step = 1; step < n; step++) {
+                int from = tour.back(), next = -1;
+                for (int c = 0; c < n; c++) {
+                    if (!used[c] && (next < 0 || at(from, c) < at(from, next))) next = c;
+                }
+                used[next] = true;
+                tour.push_back(next);
+            }
+
+            bool improved = true;
+            while (improved) {
+                improved = false;
+                for (int i = 1; i + 1 < n; i++) {
+                    for (int j = i + 1; j < n; j++) {
+                        //  tour[i..j];    ,
+                        //    
+                        vector<int> candidate = tour;
+                        reverse(candidate.begin() + i, candidate.begin() + j + 1);
+                        if (tourLength(candidate) < tourLength(tour)) {
+                            tour = move(candidate);
+                            improved = true;
+                        }
+                    }
+                }
+            }
+            return tourLength(tour);
+        }
+
+        Cost tourLength(const vector<int>& tour) const {
+            Cost length = 0;
+            for (int i = 0; i < n; i++) length += at(tour[i], tour[(i + 1) % n]);
+            return length;
+        }
+    };
+};
+
+// ====================    ====================
+
+class HeldKarpBenchmark {
+public:
+    static bool verify() {
+        cout << "===  - ===" << endl;
+        bool ok = true;
+        mt19937 gen(9);
+
+        for (int trial = 0; trial < 120 && ok; trial++) {
+            int n = 1 + trial % 9;
+            bool symmetric = trial % 2 == 0;
+            vector<vector<int>> graph = randomGraph(n, symmetric, gen);
+            int expected = bruteForce(graph);
+
+            for (int mode = 0; mode < 4 && ok; mode++) {
+                HeldKarpSolver<>::Options options;
+                options.threads = mode % 2 == 0 ? 1 : 3;
+                options.branchAndBound = mode >= 2;
+                auto result = HeldKarpSolver<>::solve(graph, options);
+                ok = result.length == expected && isTour(result.tour, n) &&
+                    tourLength(graph, result.tour) == expected;
+            }
+            auto floatResult = HeldKarpSolver<float>::solve(graph);
+            ok = ok && (int)floatResult.length == expected && tourLength(graph, floatResult.tour) == expected;
+        }
+
+        //  ,   
+        vector<vector<int>> graph = randomGraph(16, true, gen);
+        HeldKarpSolver<>::Options parallel;
+        parallel.threads = 4;
+        ok = ok && HeldKarpSolver<>::solve(graph).length == HeldKarpSolver<>::solve(graph, parallel).length;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    static void compareWithBruteForce() {
+        cout << "\n=== TSP:    - ===" << endl;
+        mt19937 gen(21);
+        unsigned threads = max(1u, thread::hardware_concurrency());
+
+        for (int n : { 8, 10, 11, 16, 20, 22 }) {
+            vector<vector<int>> graph = randomGraph(n, true, gen);
+            cout << "  n = " << n << ":";
+            int expected = -1;
+            if (n <= 11) {
+                auto start = high_resolution_clock::now();
+                expected = bruteForce(graph);
+                auto end = high_resolution_clock::now();
+                cout << "  " << duration_cast<milliseconds>(end - start).count() << " ,";
+            }
+
+            HeldKarpSolver<>::Options options;
+            options.threads = threads;
+            auto start = high_resolution_clock::now();
+            auto plain = HeldKarpSolver<>::solve(graph, options);
+            auto middle = high_resolution_clock::now();
+            options.branchAndBound = true;
+            auto bounded = HeldKarpSolver<>::solve(graph, options);
+            auto end = high_resolution_clock::now();
+
+            cout << " - " << duration_cast<milliseconds>(middle - start).count()
+                << " ,   " << duration_cast<milliseconds>(end - middle).count()
+                << "  ( " << bounded.pruned * 100 / max<uint64_t>(1, bounded.states) << "% ), "
+                << ((expected < 0 || plain.length == expected) && bounded.length == plain.length ? "OK" : "")
+                << endl;
+        }
+    }
+
+private:
+    static vector<vector<int>> randomGraph(int n, bool symmetric, mt19937& gen) {
+        //     ,    
+        vector<pair<int, int>> points(n);
+        for (auto& p : points) p = { (int)(gen() % 1000), (int)(gen() % 1000) };
+        vector<vector<int>> graph(n, vector<int>(n, 0));
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                if (i == j) continue;
+                double dx = points[i].first - points[j].first;
+                double dy = points[i].second - points[j].second;
+                graph[i][j] = (int)sqrt(dx * dx + dy * dy) + (symmetric ? 0 : (int)(gen() % 100));
+            }
+        }
+        return graph;
+    }
+
+    //  ComplexityClasses::travelingSalesman - 
+    static int bruteForce(const vector<vector<int>>& graph) {
+        int n = (int)graph.size();
+        vector<int> cities(n);
+        iota(cities.begin(), cities.end(), 0);
+        int best = INT_MAX;
+        do {
+            best = min(best, tourLength(graph, cities));
+        } while (next_permutation(cities.begin() + 1, cities.end()));
+        return best;
+    }
+
+    static int tourLength(const vector<vector<int>>& graph, const vector<int>& tour) {
+        int length = 0;
+        for (size_t i = 0; i < tour.size(); i++) length += graph[tour[i]][tour[(i + 1) % tour.size()]];
+        return length;
+    }
+
+    static bool isTour(const vector<int>& tour, int n) {
+        if ((int)tour.size() != n || tour[0] != 0) return false;
+        vector<int> sorted = tour;
+        sort(sorted.begin(), sorted.end());
+        for (int i = 0; i < n; i++) {
+            if (sorted[i] != i) return false;
+        }
+        return true;
+    }
+};
\ No newline at end of file
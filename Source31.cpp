@@ -0,0 +1,604 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================    TSP ====================
+
+//  TSP     10^4-10^5 .
+//    ( ),    2-opt  Or-opt
+// (   1-3 ).    -  k 
+//  ,    ,    
+//  O(k),   O(n).
+//
+//    order    position: next/prev  O(1),
+//   -     .  " " (
+//  )  ,     .
+//
+//          
+//  ;   
+class LocalSearchTsp {
+public:
+    struct Point {
+        double x = 0;
+        double y = 0;
+    };
+
+    struct Options {
+        unsigned threads = 1;
+        int starts = 1;             //     
+        int neighbors = 8;          //   
+        bool orOpt = true;
+        long long timeBudgetMs = 0; // 0 -  
+        uint64_t seed = 1;
+    };
+
+    struct Result {
+        vector<int> tour;
+        double length = 0;
+        double initialLength = 0;   //      
+        int startsDone = 0;
+        long long twoOptMoves = 0;
+        long long orOptMoves = 0;
+        bool timedOut = false;      //      
+    };
+
+    static Result solve(const vector<Point>& points) {
+        return solve(points, Options());
+    }
+
+    static Result solve(const vector<Point>& points, const Options& options) {
+        const int n = (int)points.size();
+        if (n == 0) {
+            throw invalid_argument(" ");
+        }
+        if (options.starts < 1 || options.neighbors < 1 || options.timeBudgetMs < 0) {
+            throw invalid_argument("   ");
+        }
+        for (const Point& p : points) {
+            if (!isfinite(p.x) || !isfinite(p.y)) {
+                throw invalid_argument("    ");
+            }
+        }
+
+        Result best;
+        if (n <= 3) {
+            for (int i = 0; i < n; i++) best.tour.push_back(i);
+            best.length = best.initialLength = tourLength(points, best.tour);
+            best.startsDone = 1;
+            return best;
+        }
+
+        auto deadline = steady_clock::time_point::max();
+        if (options.timeBudgetMs > 0) deadline = steady_clock::now() + milliseconds(options.timeBudgetMs);
+
+        unsigned threads = max(1u, min<unsigned>(options.threads, (unsigned)options.starts));
+        const Grid grid(points);
+        const int k = min(options.neighbors, n - 1);
+        const vector<int> candidates = buildNeighbors(points, grid, k, threads);
+
+        //    (,  ),  
+        //        
+        mutex bestMutex;
+        int bestStart = -1;
+        atomic<int> nextStart{ 0 };
+        auto worker = [&]() {
+            int start;
+            while ((start = nextStart.fetch_add(1)) < options.starts) {
+                if (start > 0 && steady_clock::now() >= deadline) break;
+
+                uint64_t state = options.seed + (uint64_t)start * 0x9E3779B97F4A7C15ULL;
+                int city = (int)(splitMix64(state) % (uint64_t)n);
+                Optimizer optimizer(points, candidates, k, nearestNeighborTour(points, grid, city),
+                    options.orOpt, deadline);
+                double initial = tourLength(points, optimizer.tour.order);
+                optimizer.run();
+                double length = tourLength(points, optimizer.tour.order);
+
+                lock_guard<mutex> lock(bestMutex);
+                best.startsDone++;
+                best.twoOptMoves += optimizer.twoOptMoves;
+                best.orOptMoves += optimizer.orOptMoves;
+                best.timedOut = best.timedOut || optimizer.timedOut;
+                if (bestStart < 0 || length < best.length || (length == best.length && start < bestStart)) {
+                    bestStart = start;
+                    best.length = length;
+                    best.initialLength = initial;
+                    best.tour = move(optimizer.tour.order);
+                }
+            }
+        };
+
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(worker);
+        worker();
+        for (thread& t : pool) t.join();
+
+        //     0
+        rotate(best.tour.begin(), find(best.tour.begin(), best.tour.end(), 0), best.tour.end());
+        return best;
+    }
+
+    static double tourLength(const vector<Point>& points, const vector<int>& tour) {
+        double length = 0;
+        for (size_t i = 0; i < tour.size(); i++) {
+            length += edgeLength(points[tour[i]], points[tour[(i + 1) % tour.size()]]);
+        }
+        return length;
+    }
+
+private:
+    static constexpr double EPS = 1e-9;
+
+    static double edgeLength(const Point& a, const Point& b) {
+        double dx = a.x - b.x, dy = a.y - b.y;
+        return sqrt(dx * dx + dy * dy);
+    }
+
+    static uint64_t splitMix64(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    //    ~2   .    
+    //  items; count -       (  )
+    class Grid {
+    public:
+        explicit Grid(const vector<Point>& points) {
+            const int n = (int)points.size();
+            minX = maxX = points[0].x;
+            minY = maxY = points[0].y;
+            for (const Point& p : points) {
+                minX = min(minX, p.x);
+                maxX = max(maxX, p.x);
+                minY = min(minY, p.y);
+                maxY = max(maxY, p.y);
+            }
+            double width = maxX - minX, height = maxY - minY;
+            double side = max(width, height);
+            if (side <= 0) side = 1;
+            //   (   )  
+            double area = max(width, side / n) * max(height, side / n);
+            cell = sqrt(2.0 * area / n);
+            cols = max(1, min(n, (int)(width / cell) + 1));
+            rows = max(1, min(n, (int)(height / cell) + 1));
+
+            cellStart.assign((size_t)cols * rows + 1, 0);
+            cellOf.resize(n);
+            for (int i = 0; i < n; i++) {
+                cellOf[i] = cellIndex(column(points[i].x), row(points[i].y));
+                cellStart[cellOf[i] + 1]++;
+            }
+            for (size_t c = 0; c + 1 < cellStart.size(); c++) cellStart[c + 1] += cellStart[c];
+            items.resize(n);
+            slot.resize(n);
+            count.assign((size_t)cols * rows, 0);
+            for (int i = 0; i < n; i++) {
+                int c = cellOf[i];
+                slot[i] = cellStart[c] + count[c]++;
+                items[slot[i]] = i;
+            }
+        }
+
+        void remove(int i) {
+            int c = cellOf[i];
+            int last = cellStart[c] + --count[c];
+            int moved = items[last];
+            swap(items[slot[i]], items[last]);
+            slot[moved] = slot[i];
+            slot[i] = last;
+        }
+
+        //       p,  visit  
+        // false   . visit()   
+        //    
+        template<typename Visit, typename Done>
+        void search(const Point& p, Visit visit, Done done) const {
+            int cx = column(p.x), cy = row(p.y);
+            int maxRing = max(cols, rows);
+            for (int r = 0; r <= maxRing; r++) {
+                for (int y = cy - r; y <= cy + r; y++) {
+                    if (y < 0 || y >= rows) continue;
+                    bool edgeRow = y == cy - r || y == cy + r;
+                    for (int x = cx - r; x <= cx + r; x += edgeRow ? 1 : 2 * r) {
+                        if (x >= 0 && x < cols) {
+                            int c = cellIndex(x, y);
+                            for (int s = cellStart[c]; s < cellStart[c] + count[c]; s++) visit(items[s]);
+                        }
+                        if (r == 0) break;
+                    }
+                }
+                //    r   r * cell
+                if (done(r * cell)) return;
+            }
+        }
+
+    private:
+        int column(double x) const { return min(cols - 1, (int)((x - minX) / cell)); }
+        int row(double y) const { return min(rows - 1, (int)((y - minY) / cell)); }
+        int cellIndex(int x, int y) const { return y * cols + x; }
+
+        double minX, maxX, minY, maxY, cell;
+        int cols, rows;
+        vector<int> cellStart, count, cellOf, items, slot;
+    };
+
+    // k    ,   , 
+    static vector<int> buildNeighbors(const vector<Point>& points, const Grid& grid, int k, unsigned threads) {
+        const int n = (int)points.size();
+        vector<int> candidates((size_t)n * k);
+        auto buildRange = [&](int from, int to) {
+            vector<pair<double, int>> nearest;
+            for (int i = from; i < to; i++) {
+                nearest.clear();
+                grid.search(points[i],
+                    [&](int j) {
+                        if (j == i) return;
+                        double dx = points[i].x - points[j].x, dy = points[i].y - points[j].y;
+                        pair<double, int> item = { dx * dx + dy * dy, j };
+                        if ((int)nearest.size() == k) {
+                            if (item >= nearest.back()) return;
+                            nearest.pop_back();
+                        }
+                        nearest.insert(upper_bound(nearest.begin(), nearest.end(), item), item);
+                    },
+                    [&](double bound) {
+                        return (int)nearest.size() == k && nearest.back().first <= bound * bound;
+                    });
+                for (int s = 0; s < k; s++) candidates[(size_t)i * k + s] = nearest[s].second;
+            }
+        };
+
+        if (threads <= 1 || n < 4096) {
+            buildRange(0, n);
+            return candidates;
+        }
+        vector<thread> pool;
+        for (unsigned t = 0; t < threads; t++) {
+            pool.emplace_back(buildRange, (int)((long long)n * t / threads), (int)((long long)n * (t + 1) / threads));
+        }
+        for (thread& t : pool) t.join();
+        return candidates;
+    }
+
+    //  :      
+    static vector<int> nearestNeighborTour(const vector<Point>& points, const Grid& shared, int start) {
+        const int n = (int)points.size();
+        Grid grid = shared;
+        vector<int> tour = { start };
+        grid.remove(start);
+        for (int step = 1; step < n; step++) {
+            const Point& from = points[tour.back()];
+            int next = -1;
+            double nextDistance = numeric_limits<double>::max();
+            grid.search(from,
+                [&](int j) {
+                    double dx = from.x - points[j].x, dy = from.y - points[j].y;
+                    double d = dx * dx + dy * dy;
+                    if (d < nextDistance) {
+                        nextDistance = d;
+                        next = j;
+                    }
+                },
+                [&](double bound) { return next >= 0 && nextDistance <= bound * bound; });
+            grid.remove(next);
+            tour.push_back(next);
+        }
+        return tour;
+    }
+
+    class Tour {
+    public:
+        explicit Tour(vector<int> tour) : order(move(tour)), position(order.size()), n((int)order.size()) {
+            for (int i = 0; i < n; i++) position[order[i]] = i;
+        }
+
+        int next(int c) const { int i = position[c] + 1; return order[i == n ? 0 : i]; }
+        int prev(int c) const { int i = position[c]; return order[i == 0 ? n - 1 : i - 1]; }
+
+        //   (a, b), (c, d)  (a, c), (b, d).    
+        //   b    a,  d -   c
+        void move2Opt(int a, int b, int c, int d) {
+            if (next(a) != b) {
+                //      (d, c)  (b, a)
+                swap(a, d);
+                swap(b, c);
+            }
+            reversePath(b, c);
+        }
+
+        vector<int> order;
+
+    private:
+        //   from..to (  ). 
+        //     ,     
+        void reversePath(int from, int to) {
+            int i = position[from], j = position[to];
+            int length = (j - i + n) % n + 1;
+            if (2 * length > n) {
+                i = position[next(to)];
+                j = position[prev(from)];
+                length = n - length;
+            }
+            for (int s = 0; s < length / 2; s++) {
+                swap(order[i], order[j]);
+                position[order[i]] = i;
+                position[order[j]] = j;
+                i = i + 1 == n ? 0 : i + 1;
+                j = j == 0 ? n - 1 : j - 1;
+            }
+        }
+
+        vector<int> position;
+        int n;
+    };
+
+    class Optimizer {
+    public:
+        Optimizer(const vector<Point>& points, const vector<int>& candidates, int k, vector<int> initial,
+            bool orOpt, steady_clock::time_point deadline)
+            : tour(move(initial)), points(points), candidates(candidates), k(k),
+            n((int)points.size()), orOpt(orOpt && n >= 8), deadline(deadline),
+            queue(points.size()), queued(points.size(), 0) {
+            for (int c : tour.order) push(c);
+        }
+
+        void run() {
+            long long steps = 0;
+            while (queueSize > 0) {
+                if ((++steps & 255) == 0 && steady_clock::now() >= deadline) {
+                    timedOut = true;
+                    return;
+                }
+                int a = queue[queueHead];
+                queueHead = queueHead + 1 == n ? 0 : queueHead + 1;
+                queueSize--;
+                queued[a] = 0;
+                if (improve2Opt(a) || (orOpt && improveOrOpt(a))) push(a);
+            }
+        }
+
+        Tour tour;
+        long long twoOptMoves = 0;
+        long long orOptMoves = 0;
+        bool timedOut = false;
+
+    private:
+        double dist(int a, int b) const { return edgeLength(points[a], points[b]); }
+
+        const int* neighborsOf(int a) const { return candidates.data() + (size_t)a * k; }
+
+        //  " " :     
+        void push(int c) {
+            if (queued[c]) return;
+            queued[c] = 1;
+            int tail = queueHead + queueSize;
+            queue[tail >= n ? tail - n : tail] = c;
+            queueSize++;
+        }
+
+        bool improve2Opt(int a) {
+            for (int direction = 0; direction < 2; direction++) {
+                int b = direction == 0 ? tour.next(a) : tour.prev(a);
+                double ab = dist(a, b);
+                const int* near = neighborsOf(a);
+                for (int s = 0; s < k; s++) {
+                    int c = near[s];
+                    //   (a, c)     (a, b)
+                    double gain = ab - dist(a, c);
+                    if (gain <= EPS) break;
+                    int d = direction == 0 ? tour.next(c) : tour.prev(c);
+                    if (c == b || d == a) continue;
+                    if (gain + dist(c, d) - dist(b, d) > EPS) {
+                        tour.move2Opt(a, b, c, d);
+                        twoOptMoves++;
+                        push(b);
+                        push(c);
+                        push(d);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        //   f..l (1-3 ,  a)   u, v,
+        //     
+        bool improveOrOpt(int a) {
+            for (int length = 1; length <= 3; length++) {
+                for (int side = 0; side < (length == 1 ? 1 : 2); side++) {
+                    int f = a, l = a;
+                    for (int s = 1; s < length; s++) {
+                        if (side == 0) l = tour.next(l);
+                        else f = tour.prev(f);
+                    }
+                    int p = tour.prev(f), nx = tour.next(l);
+                    double removeGain = dist(p, f) + dist(l, nx) - dist(p, nx);
+                    if (removeGain <= EPS) continue;
+
+                    for (int end = 0; end < 2; end++) {
+                        int e = end == 0 ? f : l;
+                        const int* near = neighborsOf(e);
+                        for (int s = 0; s < k; s++) {
+                            int c = near[s];
+                            if (dist(e, c) >= removeGain) break;
+                            if (inSegment(c, f, l)) continue;
+                            for (int at = 0; at < 2; at++) {
+                                int u = at == 0 ? c : tour.prev(c);
+                                int v = at == 0 ? tour.next(c) : c;
+                                if (inSegment(u, f, l) || inSegment(v, f, l) || u == nx || v == p) continue;
+                                double uv = dist(u, v);
+                                double direct = dist(u, f) + dist(l, v) - uv;
+                                double reversed = dist(u, l) + dist(f, v) - uv;
+                                if (removeGain - min(direct, reversed) > EPS) {
+                                    moveSegment(p, f, l, nx, u, v, direct < reversed);
+                                    orOptMoves++;
+                                    for (int city : { p, f, l, nx, u, v }) push(city);
+                                    return true;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool inSegment(int c, int f, int l) const {
+            for (int x = f;; x = tour.next(x)) {
+                if (x == c) return true;
+                if (x == l) return false;
+            }
+        }
+
+        //  p f..l nx ... u v ...  p nx ... u l..f v ( 
+        // 2-opt),   direct   : u f..l v
+        void moveSegment(int p, int f, int l, int nx, int u, int v, bool direct) {
+            tour.move2Opt(p, f, u, v);
+            tour.move2Opt(p, u, nx, l);
+            if (direct) tour.move2Opt(u, l, f, v);
+        }
+
+        const vector<Point>& points;
+        const vector<int>& candidates;
+        int k;
+        int n;
+        bool orOpt;
+        steady_clock::time_point deadline;
+        vector<int> queue;
+        vector<char> queued;
+        int queueHead = 0;
+        int queueSize = 0;
+    };
+};
+
+// ====================    ====================
+
+class LocalSearchTspBenchmark {
+public:
+    using Point = LocalSearchTsp::Point;
+
+    static bool verify() {
+        cout << "===    TSP ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(5);
+        uniform_real_distribution<double> coordinate(0.0, 100.0);
+
+        //     :  -   
+        //      
+        double worstRatio = 1;
+        for (int trial = 0; trial < 300 && ok; trial++) {
+            int n = 1 + (int)(gen() % 9);
+            vector<Point> points(n);
+            for (Point& p : points) p = { coordinate(gen), coordinate(gen) };
+            LocalSearchTsp::Options options;
+            options.starts = 4;
+            options.threads = trial % 2 == 0 ? 1 : 3;
+            options.neighbors = 1 + (int)(gen() % 8);
+            auto result = LocalSearchTsp::solve(points, options);
+            double optimum = bruteForce(points);
+            ok = isTour(result.tour, n) && result.tour[0] == 0 &&
+                abs(LocalSearchTsp::tourLength(points, result.tour) - result.length) < 1e-6 &&
+                result.length >= optimum - 1e-6 && result.length <= result.initialLength + 1e-6;
+            if (optimum > 0) worstRatio = max(worstRatio, result.length / optimum);
+        }
+        ok = ok && worstRatio < 1.2;
+
+        //  :      
+        vector<Point> same(50, Point{ 3, 4 });
+        auto sameResult = LocalSearchTsp::solve(same);
+        ok = ok && isTour(sameResult.tour, 50) && sameResult.length == 0;
+        vector<Point> line(200);
+        for (int i = 0; i < 200; i++) line[i] = { (double)((i * 37) % 200), 0 };
+        auto lineResult = LocalSearchTsp::solve(line);
+        ok = ok && isTour(lineResult.tour, 200) && abs(lineResult.length - 2 * 199) < 1e-6;
+
+        //         
+        vector<Point> points = randomPoints(3000, gen);
+        LocalSearchTsp::Options options;
+        options.starts = 6;
+        auto single = LocalSearchTsp::solve(points, options);
+        options.threads = 4;
+        auto parallel = LocalSearchTsp::solve(points, options);
+        ok = ok && isTour(single.tour, 3000) && single.tour == parallel.tour &&
+            single.length == parallel.length && single.startsDone == 6;
+        ok = ok && single.length < single.initialLength * 0.95;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //     .  -  --
+    //        : ~0.7124 * sqrt(n)
+    static void compareInstanceSizes(long long budgetMs = 3000) {
+        cout << "\n=== TSP: 2-OPT + OR-OPT   ( " << budgetMs << " ) ===" << endl;
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        mt19937_64 gen(11);
+        for (int n : { 1000, 10000, 100000 }) {
+            vector<Point> points = randomPoints(n, gen);
+            double reference = 0.7124 * sqrt((double)n);
+
+            LocalSearchTsp::Options options;
+            options.threads = threads;
+            options.starts = (int)threads * 2;
+            options.timeBudgetMs = budgetMs;
+            auto start = high_resolution_clock::now();
+            auto result = LocalSearchTsp::solve(points, options);
+            auto end = high_resolution_clock::now();
+
+            cout << "  n = " << n << ": " << duration_cast<milliseconds>(end - start).count() << " , "
+                << " " << result.startsDone << (result.timedOut ? " ( )" : "") << endl;
+            cout << "     : " << result.initialLength << " (+"
+                << percent(result.initialLength, reference) << "%  )" << endl;
+            cout << "     : " << result.length << " (+" << percent(result.length, reference)
+                << "%  ),  2-opt " << result.twoOptMoves << ", Or-opt " << result.orOptMoves
+                << ", " << (isTour(result.tour, n) ? "OK" : "") << endl;
+        }
+    }
+
+private:
+    static vector<Point> randomPoints(int n, mt19937_64& gen) {
+        uniform_real_distribution<double> unit(0.0, 1.0);
+        vector<Point> points(n);
+        for (Point& p : points) p = { unit(gen), unit(gen) };
+        return points;
+    }
+
+    static bool isTour(const vector<int>& tour, int n) {
+        vector<int> sorted = tour;
+        sort(sorted.begin(), sorted.end());
+        for (int i = 0; i < n; i++) {
+            if (i >= (int)sorted.size() || sorted[i] != i) return false;
+        }
+        return (int)sorted.size() == n;
+    }
+
+    static double bruteForce(const vector<Point>& points) {
+        vector<int> tour(points.size());
+        for (size_t i = 0; i < tour.size(); i++) tour[i] = (int)i;
+        double best = numeric_limits<double>::max();
+        do {
+            best = min(best, LocalSearchTsp::tourLength(points, tour));
+        } while (tour.size() > 1 && next_permutation(tour.begin() + 1, tour.end()));
+        return best;
+    }
+
+    static long long percent(double value, double reference) {
+        return llround((value / reference - 1) * 100);
+    }
+};
\ No newline at end of file
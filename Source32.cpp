@@ -0,0 +1,555 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <barrier>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#ifndef HAS_AVX2
+#define HAS_AVX2 1
+#endif
+#endif
+
+using namespace std;
+using namespace chrono;
+
+// ====================  MAX   DP ====================
+
+// dst[c] = max(src[c], src[c - weight] + value)  c  [lo, hi), c >= weight.
+// Value - int32_t (8   AVX2, 4  SSE2)  int64_t (4  AVX2;
+//  SSE2  64- ,   )
+template<typename Value>
+class KnapsackMaxPlus {
+public:
+    static_assert(is_same_v<Value, int32_t> || is_same_v<Value, int64_t>, " - int32_t  int64_t");
+
+    //   ,    : src  dst  
+    // ( 0/1   - src[c - weight]   )
+    static void descending(const Value* src, Value* dst, size_t lo, size_t hi, size_t weight, Value value) {
+        lo = max(lo, weight);
+        size_t i = hi;
+#ifdef HAS_AVX2
+        constexpr size_t lanes = 32 / sizeof(Value);
+        const __m256i add = broadcast256(value);
+        while (i >= lo + lanes) {
+            i -= lanes;
+            __m256i keep = _mm256_loadu_si256((const __m256i*)(src + i));
+            __m256i take = addLanes(_mm256_loadu_si256((const __m256i*)(src + i - weight)), add);
+            _mm256_storeu_si256((__m256i*)(dst + i), maxLanes(keep, take));
+        }
+#elif defined(HAS_SSE2)
+        if constexpr (is_same_v<Value, int32_t>) {
+            const __m128i add = _mm_set1_epi32(value);
+            while (i >= lo + 4) {
+                i -= 4;
+                __m128i keep = _mm_loadu_si128((const __m128i*)(src + i));
+                __m128i take = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(src + i - weight)), add);
+                __m128i greater = _mm_cmpgt_epi32(keep, take);
+                _mm_storeu_si128((__m128i*)(dst + i),
+                    _mm_or_si128(_mm_and_si128(greater, keep), _mm_andnot_si128(greater, take)));
+            }
+        }
+#endif
+        while (i > lo) {
+            i--;
+            dst[i] = max(src[i], (Value)(src[i - weight] + value));
+        }
+    }
+
+    //      ( ): dp[c - weight] 
+    //   .  ,   weight  
+    //   -        
+    static void ascending(Value* dp, size_t lo, size_t hi, size_t weight, Value value) {
+        size_t i = max(lo, weight);
+#ifdef HAS_AVX2
+        constexpr size_t lanes = 32 / sizeof(Value);
+        if (weight >= lanes) {
+            const __m256i add = broadcast256(value);
+            for (; i + lanes <= hi; i += lanes) {
+                __m256i keep = _mm256_loadu_si256((const __m256i*)(dp + i));
+                __m256i take = addLanes(_mm256_loadu_si256((const __m256i*)(dp + i - weight)), add);
+                _mm256_storeu_si256((__m256i*)(dp + i), maxLanes(keep, take));
+            }
+        }
+#elif defined(HAS_SSE2)
+        if constexpr (is_same_v<Value, int32_t>) {
+            if (weight >= 4) {
+                const __m128i add = _mm_set1_epi32(value);
+                for (; i + 4 <= hi; i += 4) {
+                    __m128i keep = _mm_loadu_si128((const __m128i*)(dp + i));
+                    __m128i take = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(dp + i - weight)), add);
+                    __m128i greater = _mm_cmpgt_epi32(keep, take);
+                    _mm_storeu_si128((__m128i*)(dp + i),
+                        _mm_or_si128(_mm_and_si128(greater, keep), _mm_andnot_si128(greater, take)));
+                }
+            }
+        }
+#endif
+        for (; i < hi; i++) {
+            dp[i] = max(dp[i], (Value)(dp[i - weight] + value));
+        }
+    }
+
+private:
+#ifdef HAS_AVX2
+    static __m256i broadcast256(Value value) {
+        if constexpr (is_same_v<Value, int32_t>) return _mm256_set1_epi32(value);
+        else return _mm256_set1_epi64x(value);
+    }
+
+    static __m256i addLanes(__m256i a, __m256i b) {
+        if constexpr (is_same_v<Value, int32_t>) return _mm256_add_epi32(a, b);
+        else return _mm256_add_epi64(a, b);
+    }
+
+    static __m256i maxLanes(__m256i a, __m256i b) {
+        if constexpr (is_same_v<Value, int32_t>) return _mm256_max_epi32(a, b);
+        else return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a));
+    }
+#endif
+};
+
+// ====================    ====================
+
+//   dp[c] -       c, O(n * C)
+//   O(C) .  0/1    , 
+// -  ;  (count )    1, 2, 4, ...,
+// ,    O(log count)  0/1.
+//
+//    int32_t,       (
+//    ),   int64_t.
+//
+//       :  
+//        ,    .
+//        .
+//
+//      n x C:   ,
+//     dp,     c + (C - c)
+//     (  ).   
+//   
+class KnapsackEngine {
+public:
+    static constexpr int UNBOUNDED = -1;
+
+    struct Item {
+        int weight = 0;
+        int value = 0;
+        int count = 1;      //    UNBOUNDED
+    };
+
+    struct Options {
+        unsigned threads = 1;
+    };
+
+    struct Result {
+        long long value = 0;
+        long long weight = 0;
+        vector<int> counts;     //     
+    };
+
+    static long long maxValue(const vector<Item>& items, int capacity) {
+        return maxValue(items, capacity, Options());
+    }
+
+    static long long maxValue(const vector<Item>& items, int capacity, const Options& options) {
+        Problem problem(items, capacity);
+        if (problem.fitsInt32) return problem.baseValue + problem.bestRow<int32_t>(options)[capacity];
+        return problem.baseValue + problem.bestRow<int64_t>(options)[capacity];
+    }
+
+    static Result solve(const vector<Item>& items, int capacity) {
+        return solve(items, capacity, Options());
+    }
+
+    static Result solve(const vector<Item>& items, int capacity, const Options& options) {
+        Problem problem(items, capacity);
+        Result result;
+        result.counts = problem.baseCounts;
+        vector<size_t> chosen;
+        if (problem.fitsInt32) problem.reconstruct<int32_t>(0, problem.parts.size(), capacity, options, chosen);
+        else problem.reconstruct<int64_t>(0, problem.parts.size(), capacity, options, chosen);
+        for (size_t p : chosen) result.counts[problem.parts[p].item] += problem.parts[p].copies;
+        for (size_t i = 0; i < items.size(); i++) {
+            result.value += (long long)result.counts[i] * items[i].value;
+            result.weight += (long long)result.counts[i] * items[i].weight;
+        }
+        return result;
+    }
+
+private:
+    //       
+    static constexpr size_t PARALLEL_MIN_CAPACITY = 1 << 14;
+    //          
+    static constexpr size_t TABLE_BITS = (size_t)1 << 22;
+
+    //  0/1  : copies    item
+    struct Part {
+        int weight;
+        long long value;
+        int item;
+        int copies;
+    };
+
+    class Problem {
+    public:
+        Problem(const vector<Item>& items, int capacity) : capacity(capacity), baseCounts(items.size(), 0) {
+            if (capacity < 0) {
+                throw invalid_argument("    ");
+            }
+            long double total = 0;
+            for (size_t i = 0; i < items.size(); i++) {
+                const Item& item = items[i];
+                if (item.weight < 0 || (item.count < 0 && item.count != UNBOUNDED)) {
+                    throw invalid_argument("        ");
+                }
+                if (item.value <= 0 || item.count == 0 || item.weight > capacity) continue;
+                if (item.weight == 0) {
+                    //       
+                    if (item.count == UNBOUNDED) {
+                        throw invalid_argument("      ");
+                    }
+                    baseCounts[i] = item.count;
+                    baseValue += (long long)item.count * item.value;
+                    continue;
+                }
+                int limit = capacity / item.weight;
+                int copies = item.count == UNBOUNDED ? limit : min(item.count, limit);
+                total += (long double)copies * item.value;
+                if (item.count == UNBOUNDED) {
+                    unbounded.push_back(i);
+                    weights.push_back(item.weight);
+                    values.push_back(item.value);
+                }
+                for (int size = 1; copies > 0; size *= 2) {
+                    int take = min(size, copies);
+                    parts.push_back({ item.weight * take, (long long)item.value * take, (int)i, take });
+                    copies -= take;
+                }
+            }
+            if (total + baseValue >= (long double)numeric_limits<int64_t>::max()) {
+                throw overflow_error("     int64_t");
+            }
+            fitsInt32 = total < (long double)numeric_limits<int32_t>::max();
+        }
+
+        // dp      0..capacity. 
+        //     
+        template<typename Value>
+        vector<Value> bestRow(const Options& options) const {
+            if (useParallel(options)) return partsRow<Value>(0, parts.size(), capacity, options.threads);
+            vector<Value> dp((size_t)capacity + 1, 0);
+            for (size_t u = 0; u < unbounded.size(); u++) {
+                KnapsackMaxPlus<Value>::ascending(dp.data(), 0, dp.size(), (size_t)weights[u], (Value)values[u]);
+            }
+            for (const Part& part : parts) {
+                if (isUnbounded(part.item)) continue;
+                KnapsackMaxPlus<Value>::descending(dp.data(), dp.data(), 0, dp.size(), (size_t)part.weight, (Value)part.value);
+            }
+            return dp;
+        }
+
+        template<typename Value>
+        void reconstruct(size_t lo, size_t hi, int limit, const Options& options, vector<size_t>& chosen) const {
+            if (lo == hi || limit == 0) return;
+            if (hi - lo == 1) {
+                //    :  ,  
+                if (parts[lo].weight <= limit) chosen.push_back(lo);
+                return;
+            }
+            if ((hi - lo) * ((size_t)limit + 1) <= TABLE_BITS) {
+                reconstructByTable<Value>(lo, hi, limit, chosen);
+                return;
+            }
+            size_t mid = lo + (hi - lo) / 2;
+            unsigned threads = limit >= (int)PARALLEL_MIN_CAPACITY ? options.threads : 1;
+            vector<Value> left = partsRow<Value>(lo, mid, limit, threads);
+            vector<Value> right = partsRow<Value>(mid, hi, limit, threads);
+
+            int split = 0;
+            for (int c = 1; c <= limit; c++) {
+                if (left[c] + right[limit - c] > left[split] + right[limit - split]) split = c;
+            }
+            left.clear();
+            left.shrink_to_fit();
+            right.clear();
+            right.shrink_to_fit();
+
+            reconstruct<Value>(lo, mid, split, options, chosen);
+            reconstruct<Value>(mid, hi, limit - split, options, chosen);
+        }
+
+        int capacity;
+        long long baseValue = 0;
+        vector<int> baseCounts;
+        vector<Part> parts;
+        bool fitsInt32 = true;
+
+    private:
+        bool isUnbounded(int item) const {
+            return binary_search(unbounded.begin(), unbounded.end(), (size_t)item);
+        }
+
+        bool useParallel(const Options& options) const {
+            return options.threads > 1 && (size_t)capacity >= PARALLEL_MIN_CAPACITY;
+        }
+
+        // dp   [lo, hi)   0..limit
+        template<typename Value>
+        vector<Value> partsRow(size_t lo, size_t hi, int limit, unsigned threads) const {
+            const size_t size = (size_t)limit + 1;
+            vector<Value> cur(size, 0);
+            vector<size_t> steps;
+            for (size_t p = lo; p < hi; p++) {
+                if (parts[p].weight <= limit) steps.push_back(p);
+            }
+            threads = (unsigned)max<size_t>(1, min<size_t>(threads, size / (PARALLEL_MIN_CAPACITY / 4)));
+            if (threads == 1 || steps.empty()) {
+                for (size_t p : steps) {
+                    KnapsackMaxPlus<Value>::descending(cur.data(), cur.data(), 0, size, (size_t)parts[p].weight,
+                        (Value)parts[p].value);
+                }
+                return cur;
+            }
+
+            //  :     next,   cur
+            vector<Value> next(size);
+            size_t step = 0;
+            auto onStepDone = [&]() noexcept {
+                swap(cur, next);
+                step++;
+            };
+            barrier sync((ptrdiff_t)threads, onStepDone);
+
+            auto worker = [&](unsigned t) {
+                const size_t from = size * t / threads;
+                const size_t to = size * (t + 1) / threads;
+                while (step < steps.size()) {
+                    const Part& part = parts[steps[step]];
+                    const size_t weight = (size_t)part.weight;
+                    for (size_t c = from; c < min(to, weight); c++) next[c] = cur[c];
+                    KnapsackMaxPlus<Value>::descending(cur.data(), next.data(), from, to, weight, (Value)part.value);
+                    sync.arrive_and_wait();
+                }
+            };
+
+            vector<thread> pool;
+            for (unsigned t = 1; t < threads; t++) {
+                pool.emplace_back(worker, t);
+            }
+            worker(0);
+            for (thread& th : pool) th.join();
+            return cur;
+        }
+
+        //        (, ), 
+        //    limit
+        template<typename Value>
+        void reconstructByTable(size_t lo, size_t hi, int limit, vector<size_t>& chosen) const {
+            const size_t size = (size_t)limit + 1;
+            vector<Value> dp(size, 0);
+            vector<uint64_t> taken((hi - lo) * ((size + 63) / 64), 0);
+            for (size_t p = lo; p < hi; p++) {
+                uint64_t* row = taken.data() + (p - lo) * ((size + 63) / 64);
+                const size_t weight = (size_t)parts[p].weight;
+                const Value value = (Value)parts[p].value;
+                for (size_t c = size; c-- > weight;) {
+                    Value take = dp[c - weight] + value;
+                    if (take > dp[c]) {
+                        dp[c] = take;
+                        row[c / 64] |= 1ULL << (c % 64);
+                    }
+                }
+            }
+            size_t c = (size_t)limit;
+            for (size_t p = hi; p-- > lo;) {
+                const uint64_t* row = taken.data() + (p - lo) * ((size + 63) / 64);
+                if ((row[c / 64] >> (c % 64)) & 1) {
+                    chosen.push_back(p);
+                    c -= (size_t)parts[p].weight;
+                }
+            }
+        }
+
+        vector<size_t> unbounded;       //   ,  
+        vector<int> weights;
+        vector<int> values;
+    };
+};
+
+// ====================   ====================
+
+class KnapsackEngineBenchmark {
+public:
+    using Item = KnapsackEngine::Item;
+
+    static bool verify() {
+        cout << "===     ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(9);
+
+        for (int trial = 0; trial < 600 && ok; trial++) {
+            int n = (int)(gen() % 9);
+            bool huge = trial % 5 == 4;
+            vector<Item> items(n);
+            for (Item& item : items) {
+                item.weight = (int)(gen() % 12);
+                item.value = huge ? (int)(gen() % 2000000000) : (int)(gen() % 40) - 5;
+                int kind = (int)(gen() % 3);
+                item.count = kind == 0 ? 1 : kind == 1 ? (int)(gen() % 5) : KnapsackEngine::UNBOUNDED;
+                if (item.weight == 0 && item.count == KnapsackEngine::UNBOUNDED) item.count = 2;
+            }
+            int capacity = (int)(gen() % 40);
+            long long expected = referenceKnapsack(items, capacity);
+
+            KnapsackEngine::Options options;
+            options.threads = trial % 2 == 0 ? 1 : 3;
+            auto result = KnapsackEngine::solve(items, capacity, options);
+            ok = KnapsackEngine::maxValue(items, capacity, options) == expected && result.value == expected &&
+                result.weight <= capacity && isValid(items, result);
+        }
+
+        //         
+        vector<Item> items(200);
+        for (Item& item : items) {
+            item.weight = 100 + (int)(gen() % 5000);
+            item.value = 1 + (int)(gen() % 100000);
+            item.count = (int)(gen() % 4) == 0 ? KnapsackEngine::UNBOUNDED : 1 + (int)(gen() % 3);
+        }
+        int capacity = 60000;
+        long long expected = referenceKnapsack(items, capacity);
+        KnapsackEngine::Options options;
+        long long single = KnapsackEngine::maxValue(items, capacity, options);
+        auto singleResult = KnapsackEngine::solve(items, capacity, options);
+        options.threads = 4;
+        long long parallel = KnapsackEngine::maxValue(items, capacity, options);
+        auto result = KnapsackEngine::solve(items, capacity, options);
+        ok = ok && single == expected && parallel == expected && result.value == expected &&
+            singleResult.value == expected && isValid(items, result) && isValid(items, singleResult) &&
+            result.weight <= capacity;
+
+        //    
+        vector<int> weights(18), values(18);
+        vector<Item> zeroOne(18);
+        for (int i = 0; i < 18; i++) {
+            weights[i] = 1 + (int)(gen() % 30);
+            values[i] = (int)(gen() % 100);
+            zeroOne[i] = { weights[i], values[i], 1 };
+        }
+        ok = ok && KnapsackEngine::maxValue(zeroOne, 120) == recursiveKnapsack(weights, values, 120, 18);
+
+        bool thrown = false;
+        try {
+            KnapsackEngine::maxValue({ { 0, 5, KnapsackEngine::UNBOUNDED } }, 10);
+        }
+        catch (const invalid_argument&) {
+            thrown = true;
+        }
+        ok = ok && thrown;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    // 500 :    ,    
+    static void compareWithTable(int n = 500, int capacity = 50000) {
+        cout << "\n===  0/1: " << n << " ,  " << capacity << " ===" << endl;
+        mt19937_64 gen(21);
+        vector<Item> items(n);
+        for (Item& item : items) {
+            item.weight = 1 + (int)(gen() % (capacity / 10));
+            item.value = 1 + (int)(gen() % 1000);
+        }
+
+        auto start = high_resolution_clock::now();
+        long long table = tableKnapsack(items, capacity);
+        auto end = high_resolution_clock::now();
+        cout << "   n x C: " << duration_cast<milliseconds>(end - start).count() << " , "
+            << (long long)n * (capacity + 1) * (long long)sizeof(int) / (1 << 20) << " " << endl;
+
+        start = high_resolution_clock::now();
+        long long row = KnapsackEngine::maxValue(items, capacity);
+        end = high_resolution_clock::now();
+        cout << "   ,  max: " << duration_cast<milliseconds>(end - start).count() << " , "
+            << (row == table ? "OK" : "") << endl;
+
+        KnapsackEngine::Options options;
+        options.threads = max(1u, thread::hardware_concurrency());
+        start = high_resolution_clock::now();
+        long long parallel = KnapsackEngine::maxValue(items, capacity, options);
+        end = high_resolution_clock::now();
+        cout << "   (" << options.threads << " ): "
+            << duration_cast<milliseconds>(end - start).count() << " , " << (parallel == table ? "OK" : "") << endl;
+
+        start = high_resolution_clock::now();
+        auto result = KnapsackEngine::solve(items, capacity, options);
+        end = high_resolution_clock::now();
+        cout << "    : " << duration_cast<milliseconds>(end - start).count() << " , "
+            << " " << count_if(result.counts.begin(), result.counts.end(), [](int c) { return c > 0; })
+            << ", " << (result.value == table && isValid(items, result) ? "OK" : "") << endl;
+    }
+
+private:
+    //     : dp[i][c] = max  k   i
+    static long long referenceKnapsack(const vector<Item>& items, int capacity) {
+        vector<long long> dp((size_t)capacity + 1, 0);
+        for (const Item& item : items) {
+            vector<long long> next = dp;
+            for (int c = 0; c <= capacity; c++) {
+                for (long long k = 1; item.count == KnapsackEngine::UNBOUNDED || k <= item.count; k++) {
+                    if (k * item.weight > c) break;
+                    next[c] = max(next[c], dp[c - k * item.weight] + k * item.value);
+                }
+            }
+            dp = move(next);
+        }
+        return dp[capacity];
+    }
+
+    static bool isValid(const vector<Item>& items, const KnapsackEngine::Result& result) {
+        long long value = 0, weight = 0;
+        for (size_t i = 0; i < items.size(); i++) {
+            int count = result.counts[i];
+            if (count < 0 || (items[i].count != KnapsackEngine::UNBOUNDED && count > items[i].count)) return false;
+            value += (long long)count * items[i].value;
+            weight += (long long)count * items[i].weight;
+        }
+        return value == result.value && weight == result.weight;
+    }
+
+    //   (n + 1) x (C + 1)   0/1
+    static long long tableKnapsack(const vector<Item>& items, int capacity) {
+        vector<vector<int>> dp(items.size() + 1, vector<int>((size_t)capacity + 1, 0));
+        for (size_t i = 0; i < items.size(); i++) {
+            for (int c = 0; c <= capacity; c++) {
+                dp[i + 1][c] = dp[i][c];
+                if (items[i].weight <= c) {
+                    dp[i + 1][c] = max(dp[i + 1][c], dp[i][c - items[i].weight] + items[i].value);
+                }
+            }
+        }
+        return dp[items.size()][capacity];
+    }
+
+    static int recursiveKnapsack(const vector<int>& weights, const vector<int>& values, int capacity, int n) {
+        if (n == 0 || capacity == 0) return 0;
+        if (weights[n - 1] > capacity) return recursiveKnapsack(weights, values, capacity, n - 1);
+        return max(recursiveKnapsack(weights, values, capacity, n - 1),
+            values[n - 1] + recursiveKnapsack(weights, values, capacity - weights[n - 1], n - 1));
+    }
+};
\ No newline at end of file
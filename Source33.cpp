@@ -0,0 +1,426 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <limits>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#ifndef HAS_SSE2
+#define HAS_SSE2 1
+#endif
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#ifndef HAS_AVX2
+#define HAS_AVX2 1
+#endif
+#endif
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+
+//           0..maxAmount
+//   .    ,   - 
+//  ;     ,  const- 
+//       .
+//
+//     :   c    
+// dp[a] = min(dp[a], dp[a - c] + 1),    c   
+// .  O(maxAmount * k)  k .
+//
+// BFS   0 ( -  )    :
+// O(R * k + maxAmount)  R .    ,  
+//    (,     ).
+//
+//   (   )     
+//     
+class CoinChangeTable {
+public:
+    static constexpr int UNREACHABLE = -1;
+
+    enum class Method {
+        DynamicProgramming,
+        Bfs
+    };
+
+    struct Options {
+        Method method = Method::DynamicProgramming;
+        bool countWays = false;
+        uint32_t modulus = 1000000007;  //   2^31
+    };
+
+    CoinChangeTable(const vector<int>& coins, int maxAmount)
+        : CoinChangeTable(coins, maxAmount, Options()) {
+    }
+
+    CoinChangeTable(const vector<int>& coins, int maxAmount, const Options& options)
+        : maxAmount(maxAmount), modulus(options.modulus) {
+        if (maxAmount < 0) {
+            throw invalid_argument("     ");
+        }
+        if (options.countWays && (options.modulus < 2 || options.modulus > (1u << 31))) {
+            throw invalid_argument("     [2, 2^31]");
+        }
+        for (int coin : coins) {
+            if (coin <= 0) throw invalid_argument("    ");
+            if (coin <= maxAmount) this->coins.push_back(coin);
+        }
+        sort(this->coins.begin(), this->coins.end());
+        this->coins.erase(unique(this->coins.begin(), this->coins.end()), this->coins.end());
+
+        if (options.method == Method::Bfs) buildBfs();
+        else buildDp();
+        for (int32_t& count : minTable) {
+            if (count == INF) count = UNREACHABLE;
+        }
+        if (options.countWays) buildWays();
+    }
+
+    int getMaxAmount() const {
+        return maxAmount;
+    }
+
+    const vector<int>& getCoins() const {
+        return coins;
+    }
+
+    //    BFS (  - )
+    size_t getVisited() const {
+        return visited;
+    }
+
+    int minCoins(int amount) const {
+        checkAmount(amount);
+        return minTable[amount];
+    }
+
+    uint32_t ways(int amount) const {
+        checkAmount(amount);
+        if (waysTable.empty()) {
+            throw logic_error("    ");
+        }
+        return waysTable[amount];
+    }
+
+    //  :   ,    
+    vector<int> minCoinsBatch(const vector<int>& amounts, unsigned threads = 1) const {
+        vector<int> result(amounts.size());
+        gather(amounts, threads, [&](size_t i) { result[i] = minTable[amounts[i]]; });
+        return result;
+    }
+
+    vector<uint32_t> waysBatch(const vector<int>& amounts, unsigned threads = 1) const {
+        if (waysTable.empty()) {
+            throw logic_error("    ");
+        }
+        vector<uint32_t> result(amounts.size());
+        gather(amounts, threads, [&](size_t i) { result[i] = waysTable[amounts[i]]; });
+        return result;
+    }
+
+private:
+    static constexpr int32_t INF = numeric_limits<int32_t>::max() / 2;
+    //       
+    static constexpr size_t BATCH_PER_THREAD = 1 << 16;
+
+    void checkAmount(int amount) const {
+        if (amount < 0 || amount > maxAmount) {
+            throw out_of_range(" " + to_string(amount) + "   [0, " + to_string(maxAmount) + "]");
+        }
+    }
+
+    template<typename Visit>
+    void gather(const vector<int>& amounts, unsigned threads, Visit visit) const {
+        for (int amount : amounts) checkAmount(amount);
+        threads = (unsigned)max<size_t>(1, min<size_t>(threads, amounts.size() / BATCH_PER_THREAD));
+        auto range = [&](size_t from, size_t to) {
+            for (size_t i = from; i < to; i++) visit(i);
+        };
+        if (threads == 1) {
+            range(0, amounts.size());
+            return;
+        }
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(range, amounts.size() * t / threads, amounts.size() * (t + 1) / threads);
+        }
+        range(0, amounts.size() / threads);
+        for (thread& th : pool) th.join();
+    }
+
+    void buildDp() {
+        minTable.assign((size_t)maxAmount + 1, INF);
+        minTable[0] = 0;
+        visited = minTable.size();
+        for (int coin : coins) minPlusOne(minTable.data(), (size_t)coin, minTable.size());
+    }
+
+    //  -   order:   L     L - 1
+    void buildBfs() {
+        minTable.assign((size_t)maxAmount + 1, INF);
+        minTable[0] = 0;
+        vector<int> order = { 0 };
+        for (size_t head = 0; head < order.size(); head++) {
+            int amount = order[head];
+            int next = minTable[amount] + 1;
+            for (int coin : coins) {
+                if (coin > maxAmount - amount) break;
+                int target = amount + coin;
+                if (minTable[target] == INF) {
+                    minTable[target] = next;
+                    order.push_back(target);
+                }
+            }
+        }
+        visited = order.size();
+    }
+
+    void buildWays() {
+        waysTable.assign((size_t)maxAmount + 1, 0);
+        waysTable[0] = 1 % modulus;
+        for (int coin : coins) addMod(waysTable.data(), (size_t)coin, waysTable.size());
+    }
+
+    // dp[a] = min(dp[a], dp[a - coin] + 1)    
+    static void minPlusOne(int32_t* dp, size_t coin, size_t size) {
+        size_t a = coin;
+#ifdef HAS_AVX2
+        if (coin >= 8) {
+            const __m256i one = _mm256_set1_epi32(1);
+            for (; a + 8 <= size; a += 8) {
+                __m256i keep = _mm256_loadu_si256((const __m256i*)(dp + a));
+                __m256i take = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(dp + a - coin)), one);
+                _mm256_storeu_si256((__m256i*)(dp + a), _mm256_min_epi32(keep, take));
+            }
+        }
+#elif defined(HAS_SSE2)
+        if (coin >= 4) {
+            const __m128i one = _mm_set1_epi32(1);
+            for (; a + 4 <= size; a += 4) {
+                __m128i keep = _mm_loadu_si128((const __m128i*)(dp + a));
+                __m128i take = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(dp + a - coin)), one);
+                __m128i greater = _mm_cmpgt_epi32(keep, take);
+                _mm_storeu_si128((__m128i*)(dp + a),
+                    _mm_or_si128(_mm_and_si128(greater, take), _mm_andnot_si128(greater, keep)));
+            }
+        }
+#endif
+        for (; a < size; a++) {
+            dp[a] = min(dp[a], dp[a - coin] + 1);
+        }
+    }
+
+    // ways[a] = (ways[a] + ways[a - coin]) mod p.   p <= 2^31,
+    //    uint32_t,     
+    void addMod(uint32_t* ways, size_t coin, size_t size) const {
+        size_t a = coin;
+#ifdef HAS_AVX2
+        if (coin >= 8) {
+            const __m256i p = _mm256_set1_epi32((int)modulus);
+            for (; a + 8 <= size; a += 8) {
+                __m256i sum = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(ways + a)),
+                    _mm256_loadu_si256((const __m256i*)(ways + a - coin)));
+                //  sum < p    min    sum
+                _mm256_storeu_si256((__m256i*)(ways + a), _mm256_min_epu32(sum, _mm256_sub_epi32(sum, p)));
+            }
+        }
+#elif defined(HAS_SSE2)
+        if (coin >= 4) {
+            //  SSE2    :   2^31    
+            const __m128i p = _mm_set1_epi32((int)modulus);
+            const __m128i bias = _mm_set1_epi32(INT32_MIN);
+            const __m128i limit = _mm_xor_si128(_mm_set1_epi32((int)(modulus - 1)), bias);
+            for (; a + 4 <= size; a += 4) {
+                __m128i sum = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(ways + a)),
+                    _mm_loadu_si128((const __m128i*)(ways + a - coin)));
+                __m128i reduce = _mm_cmpgt_epi32(_mm_xor_si128(sum, bias), limit);
+                _mm_storeu_si128((__m128i*)(ways + a), _mm_sub_epi32(sum, _mm_and_si128(reduce, p)));
+            }
+        }
+#endif
+        for (; a < size; a++) {
+            uint32_t sum = ways[a] + ways[a - coin];
+            ways[a] = sum >= modulus ? sum - modulus : sum;
+        }
+    }
+
+    int maxAmount;
+    uint32_t modulus;
+    vector<int> coins;
+    vector<int32_t> minTable;
+    vector<uint32_t> waysTable;
+    size_t visited = 0;
+};
+
+// ====================    ====================
+
+class CoinChangeBenchmark {
+public:
+    static bool verify() {
+        cout << "===    ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(13);
+
+        for (int trial = 0; trial < 300 && ok; trial++) {
+            int k = 1 + (int)(gen() % 4);
+            vector<int> coins(k);
+            for (int& coin : coins) coin = 1 + (int)(gen() % 12);
+            int maxAmount = (int)(gen() % 30);
+            uint32_t modulus = trial % 3 == 0 ? 7 : trial % 3 == 1 ? 1000000007 : (1u << 31);
+
+            CoinChangeTable::Options options;
+            options.countWays = true;
+            options.modulus = modulus;
+            CoinChangeTable dp(coins, maxAmount, options);
+            options.method = CoinChangeTable::Method::Bfs;
+            CoinChangeTable bfs(coins, maxAmount, options);
+
+            vector<int> amounts;
+            for (int amount = 0; amount <= maxAmount && ok; amount++) {
+                int expected = recursiveCoinChange(coins, amount);
+                ok = dp.minCoins(amount) == expected && bfs.minCoins(amount) == expected &&
+                    dp.ways(amount) == countWays(coins, amount, 0) % modulus && bfs.ways(amount) == dp.ways(amount);
+                amounts.push_back(amount);
+            }
+            ok = ok && dp.minCoinsBatch(amounts) == bfs.minCoinsBatch(amounts);
+        }
+
+        //  :    ,   
+        vector<int> coins = { 1, 2, 5, 10, 20, 50, 100, 200, 37, 3 };
+        int maxAmount = 300000;
+        CoinChangeTable::Options options;
+        options.countWays = true;
+        CoinChangeTable table(coins, maxAmount, options);
+        vector<int> scalarMin;
+        vector<uint32_t> scalarWays;
+        scalarTables(coins, maxAmount, 1000000007, scalarMin, scalarWays);
+        for (int amount = 0; amount <= maxAmount && ok; amount++) {
+            ok = table.minCoins(amount) == scalarMin[amount] && table.ways(amount) == scalarWays[amount];
+        }
+
+        //        
+        vector<int> amounts(300000);
+        for (int& amount : amounts) amount = (int)(gen() % (maxAmount + 1));
+        vector<int> batch = table.minCoinsBatch(amounts, 4);
+        vector<uint32_t> waysBatch = table.waysBatch(amounts, 4);
+        for (size_t i = 0; i < amounts.size() && ok; i++) {
+            ok = batch[i] == scalarMin[amounts[i]] && waysBatch[i] == scalarWays[amounts[i]];
+        }
+
+        bool thrown = false;
+        try {
+            table.minCoinsBatch({ 1, maxAmount + 1 });
+        }
+        catch (const out_of_range&) {
+            thrown = true;
+        }
+        ok = ok && thrown;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    static void compareMethods(int maxAmount = 10000000) {
+        cout << "\n===  :   " << maxAmount << " ===" << endl;
+        unsigned threads = max(1u, thread::hardware_concurrency());
+
+        vector<int> euro = { 1, 2, 5, 10, 20, 50, 100, 200 };
+        auto start = high_resolution_clock::now();
+        CoinChangeTable::Options options;
+        options.countWays = true;
+        CoinChangeTable table(euro, maxAmount, options);
+        auto end = high_resolution_clock::now();
+        cout << "   ,  + : " << duration_cast<milliseconds>(end - start).count()
+            << " ,  100: " << table.minCoins(100) << " , " << table.ways(100) << " " << endl;
+
+        //    997:    997- 
+        vector<int> sparse;
+        for (int multiple : { 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233 }) sparse.push_back(997 * multiple);
+        int sparseAmount = maxAmount;
+        start = high_resolution_clock::now();
+        CoinChangeTable dp(sparse, sparseAmount);
+        end = high_resolution_clock::now();
+        options = CoinChangeTable::Options();
+        options.method = CoinChangeTable::Method::Bfs;
+        auto middle = high_resolution_clock::now();
+        CoinChangeTable bfs(sparse, sparseAmount, options);
+        auto finish = high_resolution_clock::now();
+        bool same = true;
+        for (int amount = 0; amount <= sparseAmount && same; amount++) {
+            same = dp.minCoins(amount) == bfs.minCoins(amount);
+        }
+        cout << "  12 ,  997:  " << duration_cast<milliseconds>(end - start).count()
+            << " , BFS " << duration_cast<milliseconds>(finish - middle).count() << "  ( "
+            << bfs.getVisited() << "), " << (same ? "OK" : "") << endl;
+
+        mt19937_64 gen(5);
+        vector<int> amounts(4000000);
+        for (int& amount : amounts) amount = (int)(gen() % ((uint64_t)maxAmount + 1));
+        start = high_resolution_clock::now();
+        vector<int> single = table.minCoinsBatch(amounts);
+        end = high_resolution_clock::now();
+        vector<int> parallel = table.minCoinsBatch(amounts, threads);
+        finish = high_resolution_clock::now();
+        cout << "  " << amounts.size() << " :   " << duration_cast<milliseconds>(end - start).count()
+            << " , " << threads << "  " << duration_cast<milliseconds>(finish - end).count() << " , "
+            << (single == parallel ? "OK" : "") << endl;
+    }
+
+private:
+    //    PracticalExamples -    
+    static int recursiveCoinChange(const vector<int>& coins, int amount) {
+        if (amount == 0) return 0;
+        if (amount < 0) return -1;
+        int minCoins = INT_MAX;
+        for (int coin : coins) {
+            int subProblem = recursiveCoinChange(coins, amount - coin);
+            if (subProblem != -1) minCoins = min(minCoins, subProblem + 1);
+        }
+        return minCoins == INT_MAX ? -1 : minCoins;
+    }
+
+    //    :    from
+    static uint64_t countWays(const vector<int>& coins, int amount, size_t from) {
+        if (amount == 0) return 1;
+        uint64_t total = 0;
+        vector<int> sorted = coins;
+        sort(sorted.begin(), sorted.end());
+        sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+        for (size_t i = from; i < sorted.size(); i++) {
+            if (sorted[i] <= amount) total += countWays(sorted, amount - sorted[i], i);
+        }
+        return total;
+    }
+
+    static void scalarTables(const vector<int>& coins, int maxAmount, uint32_t modulus,
+        vector<int>& minCoins, vector<uint32_t>& ways) {
+        minCoins.assign((size_t)maxAmount + 1, -1);
+        ways.assign((size_t)maxAmount + 1, 0);
+        minCoins[0] = 0;
+        ways[0] = 1;
+        for (int amount = 1; amount <= maxAmount; amount++) {
+            for (int coin : coins) {
+                if (coin <= amount && minCoins[amount - coin] >= 0 &&
+                    (minCoins[amount] < 0 || minCoins[amount - coin] + 1 < minCoins[amount])) {
+                    minCoins[amount] = minCoins[amount - coin] + 1;
+                }
+            }
+        }
+        for (int coin : coins) {
+            for (int amount = coin; amount <= maxAmount; amount++) {
+                ways[amount] = (uint32_t)(((uint64_t)ways[amount] + ways[amount - coin]) % modulus);
+            }
+        }
+    }
+};
\ No newline at end of file
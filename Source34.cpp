@@ -0,0 +1,681 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <bit>
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+
+//   std::generator (C++23): co_yield    
+//    ,  -  range-for.
+//      
+template<typename T>
+class Generator {
+public:
+    struct promise_type {
+        const T* value = nullptr;
+        exception_ptr error;
+
+        Generator get_return_object() {
+            return Generator(coroutine_handle<promise_type>::from_promise(*this));
+        }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        suspend_always yield_value(const T& item) noexcept {
+            value = addressof(item);
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { error = current_exception(); }
+        void await_transform() = delete;    //   co_await 
+    };
+
+    class iterator {
+    public:
+        using iterator_category = input_iterator_tag;
+        using value_type = T;
+        using difference_type = ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(coroutine_handle<promise_type> handle) : handle(handle) {}
+
+        const T& operator*() const { return *handle.promise().value; }
+        const T* operator->() const { return handle.promise().value; }
+
+        iterator& operator++() {
+            resume(handle);
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(default_sentinel_t) const { return !handle || handle.done(); }
+
+    private:
+        coroutine_handle<promise_type> handle;
+    };
+
+    Generator(Generator&& other) noexcept : handle(exchange(other.handle, nullptr)) {}
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        if (handle) handle.destroy();
+    }
+
+    iterator begin() {
+        resume(handle);
+        return iterator(handle);
+    }
+
+    default_sentinel_t end() const { return default_sentinel; }
+
+private:
+    explicit Generator(coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    static void resume(coroutine_handle<promise_type> handle) {
+        handle.resume();
+        if (handle.promise().error) rethrow_exception(handle.promise().error);
+    }
+
+    coroutine_handle<promise_type> handle;
+};
+
+// ====================  ====================
+
+//  : current() -  , next()    
+//  false  , rank() -     
+// .     .   rank
+//     (unrank),   [0, count) 
+//    (. ParallelEnumeration)
+
+//  0..n-1   , n <= 20 (20! < 2^63).
+//  -      
+class Permutations {
+public:
+    static constexpr int MAX_SIZE = 20;
+
+    explicit Permutations(int n) : Permutations(n, 0) {}
+
+    Permutations(int n, uint64_t rank) : items(max(n, 0)), position(rank) {
+        if (n < 0 || n > MAX_SIZE) {
+            throw invalid_argument(": n  0  " + to_string(MAX_SIZE));
+        }
+        if (rank >= count(n)) {
+            throw out_of_range("   ");
+        }
+        //         
+        vector<int> unused(n);
+        for (int i = 0; i < n; i++) unused[i] = i;
+        for (int i = 0; i < n; i++) {
+            uint64_t block = count(n - 1 - i);
+            uint64_t digit = rank / block;
+            rank %= block;
+            items[i] = unused[digit];
+            unused.erase(unused.begin() + (ptrdiff_t)digit);
+        }
+    }
+
+    const vector<int>& current() const { return items; }
+    uint64_t rank() const { return position; }
+
+    bool next() {
+        if (!next_permutation(items.begin(), items.end())) return false;
+        position++;
+        return true;
+    }
+
+    static uint64_t count(int n) {
+        uint64_t result = 1;
+        for (int i = 2; i <= n; i++) result *= (uint64_t)i;
+        return result;
+    }
+
+    static uint64_t rankOf(const vector<int>& permutation) {
+        const int n = (int)permutation.size();
+        uint64_t rank = 0;
+        for (int i = 0; i < n; i++) {
+            uint64_t smaller = 0;
+            for (int j = i + 1; j < n; j++) smaller += permutation[j] < permutation[i];
+            rank += smaller * count(n - 1 - i);
+        }
+        return rank;
+    }
+
+private:
+    vector<int> items;
+    uint64_t position;
+};
+
+//   :   -    , 
+//      O(1).   , 
+//  -      Permutations
+class HeapPermutations {
+public:
+    explicit HeapPermutations(int n) : items(max(n, 0)), counters(max(n, 0), 0) {
+        if (n < 0) throw invalid_argument(": n    ");
+        for (int i = 0; i < n; i++) items[i] = i;
+    }
+
+    const vector<int>& current() const { return items; }
+
+    // ,   next()
+    pair<int, int> lastSwap() const { return swapped; }
+
+    bool next() {
+        const int n = (int)items.size();
+        while (level < n) {
+            if (counters[level] < level) {
+                int other = level % 2 == 0 ? 0 : counters[level];
+                swap(items[other], items[level]);
+                swapped = { other, level };
+                counters[level]++;
+                level = 1;
+                return true;
+            }
+            counters[level] = 0;
+            level++;
+        }
+        return false;
+    }
+
+private:
+    vector<int> items;
+    vector<int> counters;
+    int level = 1;
+    pair<int, int> swapped = { 0, 0 };
+};
+
+//  n    :    
+// ,  i   i ^ (i >> 1). n <= 63
+class GraySubsets {
+public:
+    static constexpr int MAX_SIZE = 63;
+
+    explicit GraySubsets(int n) : GraySubsets(n, 0) {}
+
+    GraySubsets(int n, uint64_t rank) : n(n), position(rank) {
+        if (n < 0 || n > MAX_SIZE) {
+            throw invalid_argument(": n  0  " + to_string(MAX_SIZE));
+        }
+        if (rank >= count(n)) {
+            throw out_of_range("   ");
+        }
+        mask = rank ^ (rank >> 1);
+    }
+
+    uint64_t current() const { return mask; }
+    uint64_t rank() const { return position; }
+
+    // ,      next()
+    int changedElement() const { return changed; }
+    bool added() const { return (mask >> changed) & 1; }
+
+    bool next() {
+        if (position + 1 >= count(n)) return false;
+        position++;
+        changed = countr_zero(position);
+        mask ^= 1ULL << changed;
+        return true;
+    }
+
+    static uint64_t count(int n) { return 1ULL << n; }
+
+    static uint64_t rankOf(uint64_t mask) {
+        for (int shift = 1; shift < 64; shift *= 2) mask ^= mask >> shift;
+        return mask;
+    }
+
+private:
+    int n;
+    uint64_t position;
+    uint64_t mask;
+    int changed = 0;
+};
+
+//  k  n    k    (),
+//  -    O(1).  -   :
+//  C(p_j, j + 1)   p_0 < p_1 < ... . n <= 63
+class Combinations {
+public:
+    static constexpr int MAX_SIZE = 63;
+
+    Combinations(int n, int k) : Combinations(n, k, 0) {}
+
+    Combinations(int n, int k, uint64_t rank) : n(n), k(k), position(rank) {
+        if (n < 0 || n > MAX_SIZE || k < 0 || k > n) {
+            throw invalid_argument(":  0 <= k <= n <= " + to_string(MAX_SIZE));
+        }
+        if (rank >= count(n, k)) {
+            throw out_of_range("   ");
+        }
+        //   -  p  C(p, j) <= rank
+        mask = 0;
+        for (int j = k; j >= 1; j--) {
+            int p = j - 1;
+            while (binomial(p + 1, j) <= rank) p++;
+            mask |= 1ULL << p;
+            rank -= binomial(p, j);
+        }
+    }
+
+    uint64_t current() const { return mask; }
+    uint64_t rank() const { return position; }
+
+    bool next() {
+        if (k == 0 || position + 1 >= count(n, k)) return false;
+        uint64_t lowest = mask & (~mask + 1);
+        uint64_t ripple = mask + lowest;
+        mask = (((ripple ^ mask) >> 2) / lowest) | ripple;
+        position++;
+        return true;
+    }
+
+    static uint64_t count(int n, int k) { return binomial(n, k); }
+
+    static uint64_t rankOf(uint64_t mask) {
+        uint64_t rank = 0;
+        for (int j = 1; mask != 0; j++, mask &= mask - 1) rank += binomial(countr_zero(mask), j);
+        return rank;
+    }
+
+    static uint64_t binomial(int n, int k) {
+        static const auto table = [] {
+            vector<vector<uint64_t>> pascal(MAX_SIZE + 2, vector<uint64_t>(MAX_SIZE + 2, 0));
+            for (int i = 0; i <= MAX_SIZE + 1; i++) {
+                pascal[i][0] = 1;
+                for (int j = 1; j <= i; j++) pascal[i][j] = pascal[i - 1][j - 1] + pascal[i - 1][j];
+            }
+            return pascal;
+        }();
+        return k < 0 || k > n ? 0 : table[n][k];
+    }
+
+private:
+    int n;
+    int k;
+    uint64_t position;
+    uint64_t mask;
+};
+
+//     n   
+//  ('(' < ')'). :   '(' ,    
+// ')'     , ,    
+//  "((...))". n <= 33:     uint64_t
+class BalancedParentheses {
+public:
+    static constexpr int MAX_PAIRS = 33;
+
+    explicit BalancedParentheses(int n) : BalancedParentheses(n, 0) {}
+
+    BalancedParentheses(int n, uint64_t rank) : n(n), text(2 * (size_t)max(n, 0), '('), position(rank) {
+        if (n < 0 || n > MAX_PAIRS) {
+            throw invalid_argument(": n  0  " + to_string(MAX_PAIRS));
+        }
+        if (rank >= count(n)) {
+            throw out_of_range("   ");
+        }
+        //    '('  completions(...)  
+        int balance = 0;
+        for (int i = 0; i < 2 * n; i++) {
+            uint64_t withOpen = completions(2 * n - i - 1, balance + 1);
+            if (rank < withOpen) {
+                text[i] = '(';
+                balance++;
+            }
+            else {
+                rank -= withOpen;
+                text[i] = ')';
+                balance--;
+            }
+        }
+    }
+
+    const string& current() const { return text; }
+    uint64_t rank() const { return position; }
+
+    bool next() {
+        const int length = 2 * n;
+        //   ,     i
+        int balance = 0;
+        for (int i = length - 1; i >= 0; i--) {
+            balance += text[i] == '(' ? -1 : 1;
+            // balance -      =   [0, i)
+            if (text[i] == '(' && balance >= 1) {
+                text[i] = ')';
+                int prefixBalance = balance - 1;
+                int open = (length - i - 1 - prefixBalance) / 2;
+                fill(text.begin() + i + 1, text.begin() + i + 1 + open, '(');
+                fill(text.begin() + i + 1 + open, text.end(), ')');
+                position++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static uint64_t count(int n) { return completions(2 * n, 0); }
+
+    static uint64_t rankOf(const string& text) {
+        const int length = (int)text.size();
+        uint64_t rank = 0;
+        int balance = 0;
+        for (int i = 0; i < length; i++) {
+            if (text[i] == ')') {
+                rank += completions(length - i - 1, balance + 1);
+                balance--;
+            }
+            else {
+                balance++;
+            }
+        }
+        return rank;
+    }
+
+private:
+    //     balance  length 
+    static uint64_t completions(int length, int balance) {
+        static const auto table = [] {
+            vector<vector<uint64_t>> ways(2 * MAX_PAIRS + 1, vector<uint64_t>(2 * MAX_PAIRS + 2, 0));
+            ways[0][0] = 1;
+            for (int len = 1; len <= 2 * MAX_PAIRS; len++) {
+                for (int b = 0; b <= len; b++) {
+                    ways[len][b] = ways[len - 1][b + 1] + (b > 0 ? ways[len - 1][b - 1] : 0);
+                }
+            }
+            return ways;
+        }();
+        if (balance < 0 || balance > length) return 0;
+        return table[length][balance];
+    }
+
+    int n;
+    string text;
+    uint64_t position;
+};
+
+// ====================     ====================
+
+class ParallelEnumeration {
+public:
+    // [0, total)   threads ;  t  
+    // make( )   visit(t, )   
+    //  . visit     
+    template<typename Make, typename Visit>
+    static void run(uint64_t total, unsigned threads, Make make, Visit visit) {
+        threads = (unsigned)max<uint64_t>(1, min<uint64_t>(threads, total));
+        auto range = [&](unsigned t) {
+            // total * t / threads  :  total % threads   1 
+            uint64_t from = total / threads * t + min<uint64_t>(t, total % threads);
+            uint64_t to = from + total / threads + (t < total % threads ? 1 : 0);
+            if (from == to) return;
+            auto enumerator = make(from);
+            for (uint64_t r = from; r < to; r++) {
+                visit(t, enumerator);
+                if (r + 1 < to) enumerator.next();
+            }
+        };
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(range, t);
+        range(0);
+        for (thread& th : pool) th.join();
+    }
+};
+
+// ==================== - ====================
+
+class LazyEnumerations {
+public:
+    static Generator<vector<int>> permutations(int n) {
+        Permutations enumerator(n);
+        do {
+            co_yield enumerator.current();
+        } while (enumerator.next());
+    }
+
+    static Generator<uint64_t> graySubsets(int n) {
+        GraySubsets enumerator(n);
+        do {
+            co_yield enumerator.current();
+        } while (enumerator.next());
+    }
+
+    static Generator<uint64_t> combinations(int n, int k) {
+        Combinations enumerator(n, k);
+        do {
+            co_yield enumerator.current();
+        } while (enumerator.next());
+    }
+
+    static Generator<string> parentheses(int n) {
+        BalancedParentheses enumerator(n);
+        do {
+            co_yield enumerator.current();
+        } while (enumerator.next());
+    }
+};
+
+// ====================   ====================
+
+class LazyEnumerationBenchmark {
+public:
+    static bool verify() {
+        cout << "===   ===" << endl;
+        bool ok = true;
+
+        // :  next_permutation,   unrank
+        for (int n = 0; n <= 7 && ok; n++) {
+            vector<int> expected(n);
+            for (int i = 0; i < n; i++) expected[i] = i;
+            Permutations enumerator(n);
+            uint64_t seen = 0;
+            do {
+                ok = ok && enumerator.current() == expected && enumerator.rank() == seen &&
+                    Permutations::rankOf(expected) == seen && Permutations(n, seen).current() == expected;
+                seen++;
+            } while (enumerator.next() && next_permutation(expected.begin(), expected.end()));
+            ok = ok && seen == Permutations::count(n);
+
+            // :  n! ,     
+            HeapPermutations heap(n);
+            vector<vector<int>> all = { heap.current() };
+            while (heap.next()) {
+                vector<int> previous = all.back();
+                auto [a, b] = heap.lastSwap();
+                swap(previous[a], previous[b]);
+                ok = ok && previous == heap.current();
+                all.push_back(heap.current());
+            }
+            sort(all.begin(), all.end());
+            ok = ok && all.size() == Permutations::count(n) && unique(all.begin(), all.end()) == all.end();
+        }
+        ok = ok && Permutations(20, Permutations::count(20) - 1).current()[0] == 19;
+
+        //    :    ,  2^n
+        for (int n = 0; n <= 10 && ok; n++) {
+            GraySubsets enumerator(n);
+            vector<bool> seen(GraySubsets::count(n), false);
+            seen[0] = true;
+            while (enumerator.next()) {
+                uint64_t mask = enumerator.current();
+                ok = ok && !seen[mask] && GraySubsets::rankOf(mask) == enumerator.rank() &&
+                    GraySubsets(n, enumerator.rank()).current() == mask &&
+                    ((mask >> enumerator.changedElement()) & 1) == enumerator.added();
+                seen[mask] = true;
+            }
+            ok = ok && count(seen.begin(), seen.end(), true) == (long long)GraySubsets::count(n);
+        }
+
+        // :    k , 
+        for (int n = 0; n <= 12 && ok; n++) {
+            for (int k = 0; k <= n && ok; k++) {
+                Combinations enumerator(n, k);
+                uint64_t previous = 0, seen = 0;
+                do {
+                    uint64_t mask = enumerator.current();
+                    ok = ok && popcount(mask) == k && mask < (1ULL << n) && (seen == 0 || mask > previous) &&
+                        Combinations::rankOf(mask) == seen && Combinations(n, k, seen).current() == mask;
+                    previous = mask;
+                    seen++;
+                } while (enumerator.next());
+                ok = ok && seen == Combinations::count(n, k);
+            }
+        }
+        ok = ok && Combinations(63, 31, Combinations::count(63, 31) - 1).current() == ((1ULL << 31) - 1) << 32;
+
+        // :        
+        for (int n = 0; n <= 8 && ok; n++) {
+            vector<string> expected;
+            recursiveParentheses(n, 0, 0, "", expected);
+            BalancedParentheses enumerator(n);
+            size_t seen = 0;
+            do {
+                ok = ok && seen < expected.size() && enumerator.current() == expected[seen] &&
+                    BalancedParentheses::rankOf(expected[seen]) == seen &&
+                    BalancedParentheses(n, seen).current() == expected[seen];
+                seen++;
+            } while (enumerator.next());
+            ok = ok && seen == expected.size() && seen == BalancedParentheses::count(n);
+        }
+        ok = ok && BalancedParentheses::count(33) == 212336130412243110ULL;
+
+        //     
+        size_t index = 0;
+        Permutations direct(4);
+        for (const vector<int>& permutation : LazyEnumerations::permutations(4)) {
+            ok = ok && permutation == direct.current();
+            direct.next();
+            index++;
+        }
+        ok = ok && index == 24;
+        index = 0;
+        for (uint64_t mask : LazyEnumerations::combinations(6, 3)) ok = ok && mask == Combinations(6, 3, index++).current();
+        ok = ok && index == 20;
+        index = 0;
+        for (uint64_t mask : LazyEnumerations::graySubsets(5)) ok = ok && GraySubsets::rankOf(mask) == index++;
+        ok = ok && index == 32;
+        index = 0;
+        for (const string& text : LazyEnumerations::parentheses(5)) ok = ok && BalancedParentheses::rankOf(text) == index++;
+        ok = ok && index == 42;
+
+        //         
+        vector<atomic<int>> hits(Permutations::count(7));
+        ParallelEnumeration::run(Permutations::count(7), 3,
+            [](uint64_t rank) { return Permutations(7, rank); },
+            [&](unsigned, const Permutations& enumerator) { hits[enumerator.rank()]++; });
+        for (atomic<int>& hit : hits) ok = ok && hit == 1;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //        ; 
+    //  (   )   
+    static void compareWithMaterialized(int n = 10) {
+        cout << "\n===   n = " << n << " (" << Permutations::count(n) << ") ===" << endl;
+
+        auto start = high_resolution_clock::now();
+        vector<int> items(n);
+        for (int i = 0; i < n; i++) items[i] = i;
+        vector<vector<int>> all;
+        materialize(items, 0, all);
+        long long materialized = 0;
+        for (const vector<int>& permutation : all) materialized += isDerangement(permutation);
+        auto end = high_resolution_clock::now();
+        cout << "    : " << duration_cast<milliseconds>(end - start).count() << " , "
+            << all.size() * (sizeof(vector<int>) + n * sizeof(int)) / (1 << 20) << " " << endl;
+        all.clear();
+        all.shrink_to_fit();
+
+        start = high_resolution_clock::now();
+        long long lazy = 0;
+        Permutations enumerator(n);
+        do {
+            lazy += isDerangement(enumerator.current());
+        } while (enumerator.next());
+        end = high_resolution_clock::now();
+        cout << "   : " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        //         :   O(1)
+        start = high_resolution_clock::now();
+        HeapPermutations heap(n);
+        int fixedPoints = n;
+        long long heapCount = n == 0;
+        while (heap.next()) {
+            auto [a, b] = heap.lastSwap();
+            const vector<int>& p = heap.current();
+            fixedPoints += (p[a] == a) + (p[b] == b) - (p[a] == b) - (p[b] == a);
+            heapCount += fixedPoints == 0;
+        }
+        end = high_resolution_clock::now();
+        cout << "      O(1): " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        start = high_resolution_clock::now();
+        long long coroutine = 0;
+        for (const vector<int>& permutation : LazyEnumerations::permutations(n)) coroutine += isDerangement(permutation);
+        end = high_resolution_clock::now();
+        cout << "  : " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        vector<long long> perThread(threads, 0);
+        start = high_resolution_clock::now();
+        ParallelEnumeration::run(Permutations::count(n), threads,
+            [n](uint64_t rank) { return Permutations(n, rank); },
+            [&](unsigned t, const Permutations& e) { perThread[t] += isDerangement(e.current()); });
+        end = high_resolution_clock::now();
+        long long parallel = 0;
+        for (long long part : perThread) parallel += part;
+        cout << "  " << threads << "   : " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        bool same = materialized == lazy && lazy == heapCount && lazy == coroutine && lazy == parallel;
+        cout << "  : " << lazy << ", " << (same ? "OK" : "") << endl;
+    }
+
+private:
+    static bool isDerangement(const vector<int>& permutation) {
+        for (size_t i = 0; i < permutation.size(); i++) {
+            if (permutation[i] == (int)i) return false;
+        }
+        return true;
+    }
+
+    static void materialize(vector<int>& items, size_t start, vector<vector<int>>& result) {
+        if (start + 1 >= items.size()) {
+            result.push_back(items);
+            return;
+        }
+        for (size_t i = start; i < items.size(); i++) {
+            swap(items[start], items[i]);
+            materialize(items, start + 1, result);
+            swap(items[start], items[i]);
+        }
+    }
+
+    static void recursiveParentheses(int n, int open, int close, string current, vector<string>& result) {
+        if ((int)current.length() == n * 2) {
+            result.push_back(current);
+            return;
+        }
+        if (open < n) recursiveParentheses(n, open + 1, close, current + "(", result);
+        if (close < open) recursiveParentheses(n, open, close + 1, current + ")", result);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,663 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <random>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================   ====================
+
+//  rows x cols,  1 -  .     ,
+//       4    . 
+//   stride  ( 64):  (r, c) -  (r + 1) * stride + c + 1
+//   ,        
+class BitGrid {
+public:
+    BitGrid(int rows, int cols) : rows(rows), cols(cols) {
+        if (rows <= 0 || cols <= 0) {
+            throw invalid_argument("    ");
+        }
+        stride = (cols + 2 + 63) / 64 * 64;
+        words.assign((size_t)(rows + 2) * stride / 64, 0);
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) set(r, c, true);
+        }
+    }
+
+    //    PracticalExamples::mazeSolver: maze[x][y] == 0 - 
+    static BitGrid fromMaze(const vector<vector<int>>& maze) {
+        if (maze.empty() || maze[0].empty()) {
+            throw invalid_argument(" ");
+        }
+        BitGrid grid((int)maze.size(), (int)maze[0].size());
+        for (int r = 0; r < grid.rows; r++) {
+            if ((int)maze[r].size() != grid.cols) {
+                throw invalid_argument("     ");
+            }
+            for (int c = 0; c < grid.cols; c++) grid.set(r, c, maze[r][c] != 0);
+        }
+        return grid;
+    }
+
+    int getRows() const { return rows; }
+    int getCols() const { return cols; }
+    int getStride() const { return stride; }
+    size_t nodeCount() const { return (size_t)(rows + 2) * stride; }
+
+    bool inside(int row, int col) const { return row >= 0 && row < rows && col >= 0 && col < cols; }
+
+    bool isOpen(int row, int col) const { return inside(row, col) && isOpen(node(row, col)); }
+    bool isOpen(int node) const { return (words[(size_t)node >> 6] >> (node & 63)) & 1; }
+
+    void set(int row, int col, bool open) {
+        if (!inside(row, col)) throw out_of_range("  ");
+        int id = node(row, col);
+        uint64_t bit = 1ULL << (id & 63);
+        if (open) words[(size_t)id >> 6] |= bit;
+        else words[(size_t)id >> 6] &= ~bit;
+    }
+
+    int node(int row, int col) const { return (row + 1) * stride + col + 1; }
+    int rowOf(int node) const { return node / stride - 1; }
+    int colOf(int node) const { return node % stride - 1; }
+
+    const uint64_t* data() const { return words.data(); }
+
+private:
+    int rows;
+    int cols;
+    int stride;
+    vector<uint64_t> words;
+};
+
+// ====================   ====================
+
+//       (    
+// ) -    f = g + h  A*   .
+//       ,     
+//  ;        32 
+class RadixHeap {
+public:
+    bool empty() const { return size == 0; }
+
+    void push(uint32_t key, int value) {
+        buckets[bucketOf(key)].push_back({ key, value });
+        size++;
+    }
+
+    pair<uint32_t, int> pop() {
+        if (buckets[0].empty()) {
+            int b = 1;
+            while (buckets[b].empty()) b++;
+            last = min_element(buckets[b].begin(), buckets[b].end())->first;
+            for (const pair<uint32_t, int>& item : buckets[b]) buckets[bucketOf(item.first)].push_back(item);
+            buckets[b].clear();
+        }
+        pair<uint32_t, int> item = buckets[0].back();
+        buckets[0].pop_back();
+        size--;
+        return item;
+    }
+
+    //      
+    void clear() {
+        for (vector<pair<uint32_t, int>>& bucket : buckets) bucket.clear();
+        last = 0;
+        size = 0;
+    }
+
+private:
+    int bucketOf(uint32_t key) const { return key == last ? 0 : 32 - countl_zero(key ^ last); }
+
+    vector<pair<uint32_t, int>> buckets[33];
+    uint32_t last = 0;
+    size_t size = 0;
+};
+
+// ====================     ====================
+
+//    4     .
+//   Bfs -   ,    ;
+//   AStar -     ;
+//   JumpPointSearch - A*    :   
+//      ,        , 
+//       ()   -      
+//     .        .
+// distanceFields -     64 :   
+// ,   ,    BFS    .
+//  ,         (
+//   ); ,   ,   , 
+// 64  BFS    - . compareDistanceFields.
+//  (, , ,  )    
+//  :     .
+//     -     GridPathfinder
+class GridPathfinder {
+public:
+    enum class Algorithm {
+        Bfs,
+        AStar,
+        JumpPointSearch
+    };
+
+    struct Cell {
+        int row = 0;
+        int col = 0;
+
+        bool operator==(const Cell& other) const { return row == other.row && col == other.col; }
+    };
+
+    struct Result {
+        bool found = false;
+        int length = -1;        //  
+        vector<Cell> path;      //     
+        size_t expanded = 0;    //   ( JPS -  )
+    };
+
+    static constexpr size_t MAX_FIELD_SOURCES = 64;
+
+    struct FieldResult {
+        size_t reached = 0;     //  (, )   
+        int levels = 0;         //  
+    };
+
+    explicit GridPathfinder(const BitGrid& grid)
+        : grid(grid), stride(grid.getStride()), stamp(grid.nodeCount(), 0), closed(grid.nodeCount(), 0),
+        cost(grid.nodeCount()), parent(grid.nodeCount()) {
+    }
+
+    Result findPath(Cell from, Cell to, Algorithm algorithm) {
+        Result result;
+        if (!grid.isOpen(from.row, from.col) || !grid.isOpen(to.row, to.col)) return result;
+        const int source = grid.node(from.row, from.col);
+        const int target = grid.node(to.row, to.col);
+        nextGeneration();
+        switch (algorithm) {
+        case Algorithm::Bfs:
+            result.expanded = bfs(source, target);
+            break;
+        case Algorithm::AStar:
+            result.expanded = aStar(source, target, false);
+            break;
+        case Algorithm::JumpPointSearch:
+            result.expanded = aStar(source, target, true);
+            break;
+        }
+        if (stamp[target] == generation) {
+            result.found = true;
+            result.length = cost[target];
+            buildPath(source, target, result.path);
+        }
+        return result;
+    }
+
+    //      ( MAX_FIELD_SOURCES) 
+    // BFS:    ,   ,    - 
+    //      .      
+    //   ,     :   ,
+    //      .  -   ,
+    //      ,     
+    FieldResult distanceFields(const vector<Cell>& sources) {
+        if (sources.size() > MAX_FIELD_SOURCES) {
+            throw invalid_argument("  64   ");
+        }
+        FieldResult result;
+        fieldSources = sources.size();
+        field.assign(grid.nodeCount() * fieldSources, -1);
+        masks.assign(grid.nodeCount(), SourceMasks());
+        frontierNodes.assign(grid.nodeCount() / 64, 0);
+        nextNodes.assign(grid.nodeCount() / 64, 0);
+        size_t lo = frontierNodes.size(), hi = 0;
+
+        for (size_t s = 0; s < sources.size(); s++) {
+            if (!grid.isOpen(sources[s].row, sources[s].col)) continue;
+            const int node = grid.node(sources[s].row, sources[s].col);
+            masks[node].frontier |= 1ULL << s;
+            masks[node].reached |= 1ULL << s;
+            frontierNodes[(size_t)node >> 6] |= 1ULL << (node & 63);
+            lo = min(lo, (size_t)node >> 6);
+            hi = max(hi, ((size_t)node >> 6) + 1);
+            field[(size_t)node * fieldSources + s] = 0;
+            result.reached++;
+        }
+
+        const int offsets[4] = { 1, -1, stride, -stride };
+        for (int level = 1; lo < hi; level++) {
+            size_t nextLo = nextNodes.size(), nextHi = 0;
+            for (size_t w = lo; w < hi; w++) {
+                for (uint64_t bits = frontierNodes[w]; bits != 0; bits &= bits - 1) {
+                    const int node = (int)(w * 64) + countr_zero(bits);
+                    const uint64_t mask = masks[node].frontier;
+                    masks[node].frontier = 0;
+                    for (int offset : offsets) {
+                        const int next = node + offset;
+                        //   :        
+                        if (!open(next)) continue;
+                        const uint64_t added = mask & ~masks[next].reached;
+                        if (added == 0) continue;
+                        masks[next].next |= added;
+                        nextNodes[(size_t)next >> 6] |= 1ULL << (next & 63);
+                        nextLo = min(nextLo, (size_t)next >> 6);
+                        nextHi = max(nextHi, ((size_t)next >> 6) + 1);
+                    }
+                }
+                frontierNodes[w] = 0;
+            }
+            for (size_t w = nextLo; w < nextHi; w++) {
+                for (uint64_t bits = nextNodes[w]; bits != 0; bits &= bits - 1) {
+                    const int node = (int)(w * 64) + countr_zero(bits);
+                    SourceMasks& current = masks[node];
+                    current.frontier = current.next;
+                    current.reached |= current.next;
+                    current.next = 0;
+                    int* distances = &field[(size_t)node * fieldSources];
+                    for (uint64_t added = current.frontier; added != 0; added &= added - 1) {
+                        distances[countr_zero(added)] = level;
+                    }
+                    result.reached += popcount(current.frontier);
+                }
+                frontierNodes[w] = nextNodes[w];
+                nextNodes[w] = 0;
+            }
+            lo = nextLo;
+            hi = nextHi;
+            if (lo < hi) result.levels = level;
+        }
+        return result;
+    }
+
+    //    source  distanceFields, -1 - 
+    int fieldDistance(size_t source, Cell cell) const {
+        if (!grid.inside(cell.row, cell.col) || source >= fieldSources) return -1;
+        return field[(size_t)grid.node(cell.row, cell.col) * fieldSources + source];
+    }
+
+private:
+    void nextGeneration() {
+        if (++generation == 0) {
+            fill(stamp.begin(), stamp.end(), 0);
+            fill(closed.begin(), closed.end(), 0);
+            generation = 1;
+        }
+    }
+
+    bool open(int node) const { return grid.isOpen(node); }
+
+    //  :        
+    bool relax(int node, int from, int newCost) {
+        if (stamp[node] == generation && cost[node] <= newCost) return false;
+        stamp[node] = generation;
+        cost[node] = newCost;
+        parent[node] = from;
+        return true;
+    }
+
+    size_t bfs(int source, int target) {
+        queue.resize(grid.nodeCount());
+        size_t head = 0, tail = 0;
+        relax(source, -1, 0);
+        queue[tail++] = source;
+        const int steps[4] = { 1, -1, stride, -stride };
+        while (head < tail && stamp[target] != generation) {
+            int node = queue[head++];
+            for (int step : steps) {
+                int next = node + step;
+                if (open(next) && stamp[next] != generation) {
+                    relax(next, node, cost[node] + 1);
+                    queue[tail++] = next;
+                }
+            }
+        }
+        return head;
+    }
+
+    int heuristic(int node, int target) const {
+        return abs(node / stride - target / stride) + abs(node % stride - target % stride);
+    }
+
+    size_t aStar(int source, int target, bool jump) {
+        heap.clear();
+        relax(source, -1, 0);
+        heap.push((uint32_t)heuristic(source, target), source);
+        size_t expanded = 0;
+        int successors[4];
+        while (!heap.empty()) {
+            int node = heap.pop().second;
+            if (closed[node] == generation) continue;
+            closed[node] = generation;
+            expanded++;
+            if (node == target) break;
+
+            int count = jump ? jumpSuccessors(node, target, successors) : gridSuccessors(node, successors);
+            for (int i = 0; i < count; i++) {
+                int next = successors[i];
+                int newCost = cost[node] + distance(node, next);
+                if (relax(next, node, newCost)) {
+                    heap.push((uint32_t)(newCost + heuristic(next, target)), next);
+                }
+            }
+        }
+        return expanded;
+    }
+
+    int distance(int a, int b) const {
+        int delta = abs(a - b);
+        return delta % stride == 0 ? delta / stride : delta;
+    }
+
+    int gridSuccessors(int node, int* out) const {
+        int count = 0;
+        for (int step : { 1, -1, stride, -stride }) {
+            if (open(node + step)) out[count++] = node + step;
+        }
+        return count;
+    }
+
+    int jumpSuccessors(int node, int target, int* out) const {
+        int count = 0;
+        auto add = [&](int jumpPoint) {
+            if (jumpPoint >= 0) out[count++] = jumpPoint;
+        };
+        if (parent[node] < 0) {
+            add(jumpHorizontal(node, 1, target));
+            add(jumpHorizontal(node, -1, target));
+            add(jumpVertical(node, stride, target));
+            add(jumpVertical(node, -stride, target));
+            return count;
+        }
+        int delta = node - parent[node];
+        if (delta % stride == 0) {
+            //   :          
+            add(jumpVertical(node, delta > 0 ? stride : -stride, target));
+            add(jumpHorizontal(node, 1, target));
+            add(jumpHorizontal(node, -1, target));
+        }
+        else {
+            //   :   
+            int dx = delta > 0 ? 1 : -1;
+            add(jumpHorizontal(node, dx, target));
+            for (int dy : { stride, -stride }) {
+                if (open(node + dy) && !open(node - dx + dy)) add(jumpVertical(node, dy, target));
+            }
+        }
+        return count;
+    }
+
+    //     :   ,  () 
+    // ,   ()  - 
+    int jumpHorizontal(int node, int dx, int target) const {
+        for (int previous = node, current = node + dx; open(current); previous = current, current += dx) {
+            if (current == target) return current;
+            if ((open(current - stride) && !open(previous - stride)) ||
+                (open(current + stride) && !open(previous + stride))) {
+                return current;
+            }
+        }
+        return -1;
+    }
+
+    //     - ,    
+    //      
+    int jumpVertical(int node, int dy, int target) const {
+        for (int current = node + dy; open(current); current += dy) {
+            if (current == target) return current;
+            if (jumpHorizontal(current, 1, target) >= 0 || jumpHorizontal(current, -1, target) >= 0) {
+                return current;
+            }
+        }
+        return -1;
+    }
+
+    //     :    
+    void buildPath(int source, int target, vector<Cell>& path) const {
+        path.clear();
+        for (int node = target; node != source; node = parent[node]) {
+            int from = parent[node];
+            int delta = node - from;
+            int step = delta % stride == 0 ? (delta > 0 ? stride : -stride) : (delta > 0 ? 1 : -1);
+            for (int cell = node; cell != from; cell -= step) path.push_back({ grid.rowOf(cell), grid.colOf(cell) });
+        }
+        path.push_back({ grid.rowOf(source), grid.colOf(source) });
+        reverse(path.begin(), path.end());
+    }
+
+    const BitGrid& grid;
+    int stride;
+    uint32_t generation = 0;
+    vector<uint32_t> stamp;
+    vector<uint32_t> closed;
+    vector<int> cost;
+    vector<int> parent;
+    vector<int> queue;
+    RadixHeap heap;
+
+    //   :  ,  ,  
+    struct SourceMasks {
+        uint64_t frontier = 0;
+        uint64_t next = 0;
+        uint64_t reached = 0;
+    };
+
+    vector<SourceMasks> masks;
+    //     ,   
+    vector<uint64_t> frontierNodes, nextNodes;
+    //     : field[node * fieldSources + s]
+    vector<int> field;
+    size_t fieldSources = 0;
+};
+
+// ====================    ====================
+
+class GridPathfinderBenchmark {
+public:
+    using Cell = GridPathfinder::Cell;
+    using Algorithm = GridPathfinder::Algorithm;
+
+    static bool verify() {
+        cout << "===      ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(19);
+
+        for (int trial = 0; trial < 300 && ok; trial++) {
+            int rows = 1 + (int)(gen() % 40), cols = 1 + (int)(gen() % 90);
+            double density = (double)(gen() % 45) / 100;
+            BitGrid grid = randomGrid(rows, cols, density, gen);
+            GridPathfinder finder(grid);
+            Cell from = randomCell(grid, gen);
+            vector<int> expected = referenceDistances(grid, from);
+
+            //     :  
+            for (int query = 0; query < 10 && ok; query++) {
+                Cell to = randomCell(grid, gen);
+                int distance = grid.isOpen(from.row, from.col) ? expected[(size_t)to.row * cols + to.col] : -1;
+                for (Algorithm algorithm : { Algorithm::Bfs, Algorithm::AStar, Algorithm::JumpPointSearch }) {
+                    auto result = finder.findPath(from, to, algorithm);
+                    ok = ok && result.found == (distance >= 0) && result.length == distance &&
+                        (!result.found || isValidPath(grid, result.path, from, to, distance));
+                }
+            }
+
+            //    :     
+            vector<Cell> sources = { from };
+            const size_t sourceCount = 1 + gen() % GridPathfinder::MAX_FIELD_SOURCES;
+            while (sources.size() < sourceCount) {
+                sources.push_back(gen() % 8 == 0 ? sources[gen() % sources.size()] : randomCell(grid, gen));
+            }
+            auto field = finder.distanceFields(sources);
+            size_t reached = 0;
+            for (size_t s = 0; s < sources.size() && ok; s++) {
+                vector<int> distances = referenceDistances(grid, sources[s]);
+                for (int r = 0; r < rows && ok; r++) {
+                    for (int c = 0; c < cols && ok; c++) {
+                        int distance = distances[(size_t)r * cols + c];
+                        ok = finder.fieldDistance(s, { r, c }) == distance;
+                        reached += distance >= 0;
+                    }
+                }
+            }
+            ok = ok && field.reached == reached;
+        }
+
+        //   mazeSolver
+        vector<vector<int>> maze = {
+            { 1, 0, 1, 1, 1 },
+            { 1, 0, 1, 0, 1 },
+            { 1, 1, 1, 0, 1 },
+            { 0, 0, 0, 0, 1 },
+            { 1, 1, 1, 1, 1 }
+        };
+        BitGrid mazeGrid = BitGrid::fromMaze(maze);
+        GridPathfinder mazeFinder(mazeGrid);
+        auto mazePath = mazeFinder.findPath({ 0, 0 }, { 4, 0 }, Algorithm::JumpPointSearch);
+        ok = ok && mazePath.found && mazePath.length == 16;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //  2000 x 2000:  DFS    
+    static void compareAlgorithms(int size = 2000) {
+        cout << "\n===  :  " << size << " x " << size << " ===" << endl;
+        mt19937_64 gen(23);
+        for (double density : { 0.0, 0.2, 0.35 }) {
+            BitGrid grid = randomGrid(size, size, density, gen);
+            grid.set(0, 0, true);
+            grid.set(size - 1, size - 1, true);
+            GridPathfinder finder(grid);
+            cout << "   " << (int)(density * 100) << "%:" << endl;
+
+            const char* names[] = { "BFS", "A*", "JPS" };
+            int index = 0;
+            for (Algorithm algorithm : { Algorithm::Bfs, Algorithm::AStar, Algorithm::JumpPointSearch }) {
+                auto start = high_resolution_clock::now();
+                auto result = finder.findPath({ 0, 0 }, { size - 1, size - 1 }, algorithm);
+                auto end = high_resolution_clock::now();
+                cout << "    " << names[index++] << ": " << duration_cast<microseconds>(end - start).count() / 1000.0
+                    << " ,  " << result.expanded << ",  " << result.length << endl;
+            }
+        }
+    }
+
+    // 64  : 64 BFS       .
+    //         8 x 8 -  
+    //         
+    static void compareDistanceFields(int size = 500) {
+        cout << "\n===    64 :  " << size << " x " << size << " ===" << endl;
+        mt19937_64 gen(29);
+        const int count = (int)GridPathfinder::MAX_FIELD_SOURCES;
+        for (double density : { 0.0, 0.2, 0.35 }) {
+            BitGrid grid = randomGrid(size, size, density, gen);
+            vector<Cell> scattered, clustered;
+            for (int s = 0; s < count; s++) {
+                scattered.push_back(randomCell(grid, gen));
+                clustered.push_back({ size / 2 + s / 8, size / 2 + s % 8 });
+            }
+            for (Cell cell : clustered) grid.set(cell.row, cell.col, true);
+            GridPathfinder finder(grid);
+
+            cout << "   " << (int)(density * 100) << "%:" << endl;
+            for (const vector<Cell>* sources : { &scattered, &clustered }) {
+                vector<int> distances, queue;
+                long long checksum = 0;
+                auto start = high_resolution_clock::now();
+                for (Cell source : *sources) {
+                    scalarField(grid, source, distances, queue);
+                    checksum += accumulate(distances.begin(), distances.end(), 0LL);
+                }
+                auto middle = high_resolution_clock::now();
+                auto field = finder.distanceFields(*sources);
+                auto end = high_resolution_clock::now();
+
+                bool same = true;
+                for (int s = 0; s < count && same; s++) {
+                    scalarField(grid, (*sources)[s], distances, queue);
+                    for (int r = 0; r < size && same; r++) {
+                        for (int c = 0; c < size && same; c++) {
+                            same = finder.fieldDistance(s, { r, c }) == distances[grid.node(r, c)];
+                        }
+                    }
+                }
+                cout << "    " << (sources == &scattered ? "" : " 8x8") << ": 64 BFS   "
+                    << duration_cast<milliseconds>(middle - start).count() << " ,  "
+                    << duration_cast<milliseconds>(end - middle).count() << "  (" << field.levels << " , "
+                    << field.reached << " ,  " << checksum << "), " << (same ? "OK" : "") << endl;
+            }
+        }
+    }
+
+private:
+    static BitGrid randomGrid(int rows, int cols, double density, mt19937_64& gen) {
+        BitGrid grid(rows, cols);
+        uniform_real_distribution<double> unit(0.0, 1.0);
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                if (unit(gen) < density) grid.set(r, c, false);
+            }
+        }
+        return grid;
+    }
+
+    static Cell randomCell(const BitGrid& grid, mt19937_64& gen) {
+        return { (int)(gen() % grid.getRows()), (int)(gen() % grid.getCols()) };
+    }
+
+    // BFS  vector<vector>    - 
+    static vector<int> referenceDistances(const BitGrid& grid, Cell from) {
+        const int rows = grid.getRows(), cols = grid.getCols();
+        vector<int> distance((size_t)rows * cols, -1);
+        if (!grid.isOpen(from.row, from.col)) return distance;
+        vector<Cell> queue = { from };
+        distance[(size_t)from.row * cols + from.col] = 0;
+        const int dr[4] = { 1, -1, 0, 0 }, dc[4] = { 0, 0, 1, -1 };
+        for (size_t head = 0; head < queue.size(); head++) {
+            Cell cell = queue[head];
+            for (int d = 0; d < 4; d++) {
+                int r = cell.row + dr[d], c = cell.col + dc[d];
+                if (grid.isOpen(r, c) && distance[(size_t)r * cols + c] < 0) {
+                    distance[(size_t)r * cols + c] = distance[(size_t)cell.row * cols + cell.col] + 1;
+                    queue.push_back({ r, c });
+                }
+            }
+        }
+        return distance;
+    }
+
+    // BFS        - ,    
+    //   
+    static void scalarField(const BitGrid& grid, Cell from, vector<int>& distance, vector<int>& queue) {
+        distance.assign(grid.nodeCount(), -1);
+        queue.clear();
+        if (!grid.isOpen(from.row, from.col)) return;
+        const int source = grid.node(from.row, from.col);
+        const int offsets[4] = { 1, -1, grid.getStride(), -grid.getStride() };
+        distance[source] = 0;
+        queue.push_back(source);
+        for (size_t head = 0; head < queue.size(); head++) {
+            const int node = queue[head];
+            for (int offset : offsets) {
+                const int next = node + offset;
+                if (grid.isOpen(next) && distance[next] < 0) {
+                    distance[next] = distance[node] + 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
+    static bool isValidPath(const BitGrid& grid, const vector<Cell>& path, Cell from, Cell to, int length) {
+        if ((int)path.size() != length + 1 || !(path.front() == from) || !(path.back() == to)) return false;
+        for (size_t i = 0; i < path.size(); i++) {
+            if (!grid.isOpen(path[i].row, path[i].col)) return false;
+            if (i > 0 && abs(path[i].row - path[i - 1].row) + abs(path[i].col - path[i - 1].col) != 1) return false;
+        }
+        return true;
+    }
+};
\ No newline at end of file
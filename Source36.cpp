@@ -0,0 +1,573 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <barrier>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================    ====================
+
+//       (   ) 
+// 32-   :   ,  
+//   ,     ,  .
+//  :    ,    
+template<typename T>
+class ArenaTree {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    //         :
+    //   BreadthFirst -  ,    ;
+    //   VanEmdeBoas - :   ,  
+    //      .     O(log n / log B) 
+    //      B      
+    enum class Layout {
+        BreadthFirst,
+        VanEmdeBoas
+    };
+
+    void reserve(size_t count) {
+        values.reserve(count);
+        children.reserve(2 * count);
+    }
+
+    uint32_t add(const T& value, uint32_t left = NONE, uint32_t right = NONE) {
+        if (values.size() >= NONE) {
+            throw overflow_error("     32- ");
+        }
+        values.push_back(value);
+        children.push_back(left);
+        children.push_back(right);
+        if (root == NONE) root = 0;
+        return (uint32_t)(values.size() - 1);
+    }
+
+    void setLeft(uint32_t node, uint32_t child) { children.at(2 * (size_t)node) = child; }
+    void setRight(uint32_t node, uint32_t child) { children.at(2 * (size_t)node + 1) = child; }
+    void setRoot(uint32_t node) {
+        if (node != NONE && node >= values.size()) throw out_of_range("  ");
+        root = node;
+    }
+
+    size_t size() const { return values.size(); }
+    uint32_t getRoot() const { return root; }
+    const T& value(uint32_t node) const { return values[node]; }
+    uint32_t left(uint32_t node) const { return children[2 * (size_t)node]; }
+    uint32_t right(uint32_t node) const { return children[2 * (size_t)node + 1]; }
+
+    //     ( value, left, right,  
+    // RecursiveAlgorithms::TreeNode)    
+    template<typename Node>
+    static ArenaTree fromPointers(const Node* pointerRoot) {
+        ArenaTree tree;
+        if (pointerRoot == nullptr) return tree;
+        //   ,     
+        struct Pending {
+            const Node* node;
+            uint32_t parent;
+            bool isLeft;
+        };
+        vector<Pending> stack = { { pointerRoot, NONE, false } };
+        while (!stack.empty()) {
+            Pending item = stack.back();
+            stack.pop_back();
+            uint32_t index = tree.add(item.node->value);
+            if (item.parent != NONE) {
+                tree.children[2 * (size_t)item.parent + (item.isLeft ? 0 : 1)] = index;
+            }
+            if (item.node->right != nullptr) stack.push_back({ item.node->right, index, false });
+            if (item.node->left != nullptr) stack.push_back({ item.node->left, index, true });
+        }
+        return tree;
+    }
+
+    //      : 
+    //  -  ,  bit_width(n)
+    static ArenaTree fromSorted(const vector<T>& sorted, Layout layout = Layout::VanEmdeBoas) {
+        if (sorted.size() >= NONE) {
+            throw overflow_error("     32- ");
+        }
+        if (!is_sorted(sorted.begin(), sorted.end())) {
+            throw invalid_argument("   ");
+        }
+        ArenaTree tree;
+        const uint32_t n = (uint32_t)sorted.size();
+        if (n == 0) return tree;
+
+        //      
+        vector<uint32_t> shapeLeft(n, NONE), shapeRight(n, NONE);
+        struct Range {
+            uint32_t lo, hi;
+        };
+        vector<Range> ranges = { { 0, n } };
+        while (!ranges.empty()) {
+            Range range = ranges.back();
+            ranges.pop_back();
+            uint32_t mid = range.lo + (range.hi - range.lo) / 2;
+            if (range.lo < mid) {
+                shapeLeft[mid] = range.lo + (mid - range.lo) / 2;
+                ranges.push_back({ range.lo, mid });
+            }
+            if (mid + 1 < range.hi) {
+                shapeRight[mid] = mid + 1 + (range.hi - mid - 1) / 2;
+                ranges.push_back({ mid + 1, range.hi });
+            }
+        }
+        const uint32_t shapeRoot = n / 2;
+
+        vector<uint32_t> order;
+        order.reserve(n);
+        if (layout == Layout::BreadthFirst) {
+            order.push_back(shapeRoot);
+            for (size_t head = 0; head < order.size(); head++) {
+                if (shapeLeft[order[head]] != NONE) order.push_back(shapeLeft[order[head]]);
+                if (shapeRight[order[head]] != NONE) order.push_back(shapeRight[order[head]]);
+            }
+        }
+        else {
+            vanEmdeBoasOrder(shapeLeft, shapeRight, shapeRoot, (int)bit_width(n), order);
+        }
+
+        vector<uint32_t> position(n);
+        for (uint32_t i = 0; i < n; i++) position[order[i]] = i;
+        tree.values.resize(n);
+        tree.children.resize(2 * (size_t)n);
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t s = order[i];
+            tree.values[i] = sorted[s];
+            tree.children[2 * (size_t)i] = shapeLeft[s] == NONE ? NONE : position[shapeLeft[s]];
+            tree.children[2 * (size_t)i + 1] = shapeRight[s] == NONE ? NONE : position[shapeRight[s]];
+        }
+        tree.root = 0;
+        return tree;
+    }
+
+    //    :     key  NONE
+    uint32_t find(const T& key) const {
+        uint32_t node = root;
+        while (node != NONE) {
+            const T& current = values[node];
+            if (!(key < current) && !(current < key)) return node;
+            node = children[2 * (size_t)node + (current < key ? 1 : 0)];
+        }
+        return NONE;
+    }
+
+    int height() const {
+        int levels = 0;
+        forEachLevel([&](const vector<uint32_t>&) { levels++; });
+        return levels;
+    }
+
+    //     ( RecursiveAlgorithms::dfs)
+    template<typename Visit>
+    void preorder(Visit visit) const {
+        if (root == NONE) return;
+        vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(root);
+        while (!stack.empty()) {
+            uint32_t node = stack.back();
+            stack.pop_back();
+            visit(node);
+            if (right(node) != NONE) stack.push_back(right(node));
+            if (left(node) != NONE) stack.push_back(left(node));
+        }
+    }
+
+    //  :    -  
+    template<typename Visit>
+    void inorder(Visit visit) const {
+        vector<uint32_t> stack;
+        stack.reserve(64);
+        uint32_t node = root;
+        while (node != NONE || !stack.empty()) {
+            for (; node != NONE; node = left(node)) stack.push_back(node);
+            node = stack.back();
+            stack.pop_back();
+            visit(node);
+            node = right(node);
+        }
+    }
+
+    //    ( RecursiveAlgorithms::bfs):   - 
+    // ,      
+    template<typename Visit>
+    void levelOrder(Visit visit) const {
+        forEachLevel([&](const vector<uint32_t>& level) {
+            for (uint32_t node : level) visit(node);
+        });
+    }
+
+    //   ,   - :  t   
+    //       ,   
+    //       ,   
+    //     ,   levelOrder. visit(worker, node) 
+    //         ( 
+    //    )
+    template<typename Visit>
+    void parallelLevelOrder(unsigned threads, Visit visit) const {
+        if (root == NONE) return;
+        threads = max(1u, threads);
+        vector<uint32_t> frontier = { root }, next;
+        vector<vector<uint32_t>> local(threads);
+        vector<size_t> offset(threads + 1, 0);
+        bool done = false;
+
+        auto onCollected = [&]() noexcept {
+            for (unsigned t = 0; t < threads; t++) offset[t + 1] = offset[t] + local[t].size();
+            next.resize(offset[threads]);
+        };
+        auto onCopied = [&]() noexcept {
+            swap(frontier, next);
+            done = frontier.empty();
+        };
+        barrier collected((ptrdiff_t)threads, onCollected);
+        barrier copied((ptrdiff_t)threads, onCopied);
+
+        auto worker = [&](unsigned t) {
+            while (!done) {
+                const size_t from = frontier.size() * t / threads;
+                const size_t to = frontier.size() * (t + 1) / threads;
+                vector<uint32_t>& children = local[t];
+                children.clear();
+                for (size_t i = from; i < to; i++) {
+                    uint32_t node = frontier[i];
+                    visit(t, node);
+                    if (left(node) != NONE) children.push_back(left(node));
+                    if (right(node) != NONE) children.push_back(right(node));
+                }
+                collected.arrive_and_wait();
+                copy(children.begin(), children.end(), next.begin() + offset[t]);
+                copied.arrive_and_wait();
+            }
+        };
+
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; t++) {
+            pool.emplace_back(worker, t);
+        }
+        worker(0);
+        for (thread& th : pool) th.join();
+    }
+
+private:
+    template<typename OnLevel>
+    void forEachLevel(OnLevel onLevel) const {
+        if (root == NONE) return;
+        vector<uint32_t> frontier = { root }, next;
+        while (!frontier.empty()) {
+            onLevel(frontier);
+            next.clear();
+            for (uint32_t node : frontier) {
+                if (left(node) != NONE) next.push_back(left(node));
+                if (right(node) != NONE) next.push_back(right(node));
+            }
+            swap(frontier, next);
+        }
+    }
+
+    //        height:  height / 2
+    // ,       .   -
+    // O(log height),       : O(n log log n)
+    static void vanEmdeBoasOrder(const vector<uint32_t>& shapeLeft, const vector<uint32_t>& shapeRight,
+        uint32_t subtree, int height, vector<uint32_t>& order) {
+        if (height == 1) {
+            order.push_back(subtree);
+            return;
+        }
+        const int top = height / 2;
+        vanEmdeBoasOrder(shapeLeft, shapeRight, subtree, top, order);
+
+        //   :    top,  
+        vector<pair<uint32_t, int>> stack = { { subtree, 0 } };
+        while (!stack.empty()) {
+            auto [node, depth] = stack.back();
+            stack.pop_back();
+            if (depth == top) {
+                vanEmdeBoasOrder(shapeLeft, shapeRight, node, height - top, order);
+                continue;
+            }
+            if (shapeRight[node] != NONE) stack.push_back({ shapeRight[node], depth + 1 });
+            if (shapeLeft[node] != NONE) stack.push_back({ shapeLeft[node], depth + 1 });
+        }
+    }
+
+    vector<T> values;
+    vector<uint32_t> children;      //      i -  2i  2i + 1
+    uint32_t root = NONE;
+};
+
+// ====================     ====================
+
+class ArenaTreeBenchmark {
+public:
+    using Tree = ArenaTree<int>;
+    using Layout = Tree::Layout;
+
+    static bool verify() {
+        cout << "===     ===" << endl;
+        bool ok = true;
+        mt19937_64 gen(29);
+
+        //      15 :  ,  4 
+        vector<int> fifteen(15);
+        for (int i = 0; i < 15; i++) fifteen[i] = i;
+        Tree veb15 = Tree::fromSorted(fifteen);
+        const int expected15[] = { 7, 3, 11, 1, 0, 2, 5, 4, 6, 9, 8, 10, 13, 12, 14 };
+        for (uint32_t i = 0; i < 15; i++) ok = ok && veb15.value(i) == expected15[i];
+
+        for (int trial = 0; trial < 200 && ok; trial++) {
+            int n = (int)(gen() % 3000);
+            vector<int> sorted(n);
+            for (int i = 0; i < n; i++) sorted[i] = 3 * i + 1;
+
+            Tree bfsTree = Tree::fromSorted(sorted, Layout::BreadthFirst);
+            Tree vebTree = Tree::fromSorted(sorted, Layout::VanEmdeBoas);
+            ok = ok && bfsTree.size() == (size_t)n && vebTree.size() == (size_t)n;
+            const int height = (int)bit_width((unsigned)n);
+            ok = ok && bfsTree.height() == height && vebTree.height() == height;
+            ok = ok && valuesOf(bfsTree, Order::In) == sorted;
+            ok = ok && valuesOf(vebTree, Order::In) == sorted;
+            ok = ok && valuesOf(vebTree, Order::Level) ==
+                valuesOf(bfsTree, Order::Level);
+            ok = ok && valuesOf(vebTree, Order::Pre) ==
+                valuesOf(bfsTree, Order::Pre);
+            for (int i = 0; i < n && ok; i++) {
+                uint32_t found = vebTree.find(sorted[i]);
+                ok = found != Tree::NONE && vebTree.value(found) == sorted[i] && vebTree.find(sorted[i] + 1) == Tree::NONE;
+            }
+            ok = ok && vebTree.find(0) == Tree::NONE;
+
+            //  :     ,   
+            vector<int> depth(n, -1);
+            vebTree.levelOrder([&](uint32_t node) {
+                if (node == vebTree.getRoot()) depth[node] = 0;
+                if (vebTree.left(node) != Tree::NONE) depth[vebTree.left(node)] = depth[node] + 1;
+                if (vebTree.right(node) != Tree::NONE) depth[vebTree.right(node)] = depth[node] + 1;
+            });
+            vector<atomic<int>> seen(n);
+            atomic<int> order{ 0 };
+            vector<int> visitedAt(n, -1);
+            vebTree.parallelLevelOrder(4, [&](unsigned, uint32_t node) {
+                seen[node]++;
+                visitedAt[node] = order++;
+            });
+            vector<uint32_t> byTime(n);
+            for (int i = 0; i < n; i++) {
+                ok = ok && seen[i] == 1;
+                if (visitedAt[i] >= 0) byTime[visitedAt[i]] = (uint32_t)i;
+            }
+            for (int i = 1; i < n && ok; i++) ok = depth[byTime[i - 1]] <= depth[byTime[i]];
+        }
+
+        //    :  ,  
+        for (int trial = 0; trial < 50 && ok; trial++) {
+            int n = (int)(gen() % 2000);
+            vector<PointerNode> storage(n);
+            PointerNode* pointerRoot = nullptr;
+            for (int i = 0; i < n; i++) {
+                storage[i].value = (int)(gen() % 100000);
+                PointerNode** slot = &pointerRoot;
+                while (*slot != nullptr) slot = storage[i].value < (*slot)->value ? &(*slot)->left : &(*slot)->right;
+                *slot = &storage[i];
+            }
+            Tree copy = Tree::fromPointers(pointerRoot);
+            vector<int> expected;
+            recursivePreorder(pointerRoot, expected);
+            ok = ok && copy.size() == (size_t)n && valuesOf(copy, Order::Pre) == expected;
+            expected.clear();
+            queue<PointerNode*> q;
+            if (pointerRoot != nullptr) q.push(pointerRoot);
+            while (!q.empty()) {
+                PointerNode* current = q.front();
+                q.pop();
+                expected.push_back(current->value);
+                if (current->left) q.push(current->left);
+                if (current->right) q.push(current->right);
+            }
+            ok = ok && valuesOf(copy, Order::Level) == expected;
+        }
+
+        //  :       
+        Tree chain;
+        const uint32_t chainLength = 1000000;
+        chain.reserve(chainLength);
+        for (uint32_t i = 0; i < chainLength; i++) chain.add((int)i, i + 1 < chainLength ? i + 1 : Tree::NONE);
+        long long chainSum = 0;
+        chain.preorder([&](uint32_t node) { chainSum += chain.value(node); });
+        ok = ok && chainSum == (long long)chainLength * (chainLength - 1) / 2 && chain.height() == (int)chainLength;
+
+        bool threw = false;
+        try {
+            Tree::fromSorted({ 3, 1, 2 });
+        }
+        catch (const invalid_argument&) {
+            threw = true;
+        }
+        ok = ok && threw;
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //    (  ,    
+    // )          
+    static void compareTraversals(int n = 10000000, int lookups = 2000000) {
+        cout << "\n===   " << n << "  ===" << endl;
+        vector<int> sorted(n);
+        for (int i = 0; i < n; i++) sorted[i] = 2 * i;
+
+        mt19937_64 gen(31);
+        vector<PointerNode> storage(n);
+        vector<PointerNode*> slots(n);
+        for (int i = 0; i < n; i++) slots[i] = &storage[i];
+        shuffle(slots.begin(), slots.end(), gen);
+        PointerNode* pointerRoot = buildPointerTree(sorted, slots);
+
+        Tree bfsTree = Tree::fromSorted(sorted, Layout::BreadthFirst);
+        auto start = high_resolution_clock::now();
+        Tree vebTree = Tree::fromSorted(sorted, Layout::VanEmdeBoas);
+        auto end = high_resolution_clock::now();
+        cout << "   : " << duration_cast<milliseconds>(end - start).count() << " " << endl;
+
+        long long sum = 0;
+        start = high_resolution_clock::now();
+        recursiveSum(pointerRoot, sum);
+        end = high_resolution_clock::now();
+        long long pointerDfs = duration_cast<milliseconds>(end - start).count();
+        long long arenaSum = 0;
+        start = high_resolution_clock::now();
+        vebTree.preorder([&](uint32_t node) { arenaSum += vebTree.value(node); });
+        end = high_resolution_clock::now();
+        cout << "DFS:  " << pointerDfs << " ,  " << duration_cast<milliseconds>(end - start).count()
+            << " " << (sum == arenaSum ? "" : " ") << endl;
+
+        start = high_resolution_clock::now();
+        sum = 0;
+        queue<PointerNode*> q;
+        q.push(pointerRoot);
+        while (!q.empty()) {
+            PointerNode* current = q.front();
+            q.pop();
+            sum += current->value;
+            if (current->left) q.push(current->left);
+            if (current->right) q.push(current->right);
+        }
+        end = high_resolution_clock::now();
+        long long pointerBfs = duration_cast<milliseconds>(end - start).count();
+        arenaSum = 0;
+        start = high_resolution_clock::now();
+        bfsTree.levelOrder([&](uint32_t node) { arenaSum += bfsTree.value(node); });
+        end = high_resolution_clock::now();
+        long long arenaBfs = duration_cast<milliseconds>(end - start).count();
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        vector<long long> partial(threads, 0);
+        start = high_resolution_clock::now();
+        bfsTree.parallelLevelOrder(threads, [&](unsigned t, uint32_t node) { partial[t] += bfsTree.value(node); });
+        end = high_resolution_clock::now();
+        long long parallelSum = 0;
+        for (long long part : partial) parallelSum += part;
+        cout << "BFS:   " << pointerBfs << " ,  " << arenaBfs << " ,    "
+            << threads << "  " << duration_cast<milliseconds>(end - start).count() << " "
+            << (sum == arenaSum && sum == parallelSum ? "" : " ") << endl;
+
+        vector<int> keys(lookups);
+        for (int& key : keys) key = (int)(gen() % (2 * (uint64_t)n));
+        auto timeLookups = [&](auto&& find) {
+            size_t found = 0;
+            auto begin = high_resolution_clock::now();
+            for (int key : keys) found += find(key);
+            auto finish = high_resolution_clock::now();
+            return make_pair(duration_cast<milliseconds>(finish - begin).count(), found);
+        };
+        auto pointerFind = timeLookups([&](int key) {
+            const PointerNode* node = pointerRoot;
+            while (node != nullptr && node->value != key) node = key < node->value ? node->left : node->right;
+            return node != nullptr;
+        });
+        auto bfsFind = timeLookups([&](int key) { return bfsTree.find(key) != Tree::NONE; });
+        auto vebFind = timeLookups([&](int key) { return vebTree.find(key) != Tree::NONE; });
+        cout << lookups << " :  " << pointerFind.first << " ,   " << bfsFind.first
+            << " ,    " << vebFind.first << " "
+            << (pointerFind.second == bfsFind.second && bfsFind.second == vebFind.second ? "" : " ") << endl;
+    }
+
+private:
+    //   ,  RecursiveAlgorithms::TreeNode
+    struct PointerNode {
+        int value = 0;
+        PointerNode* left = nullptr;
+        PointerNode* right = nullptr;
+    };
+
+    enum class Order {
+        Pre,
+        In,
+        Level
+    };
+
+    static vector<int> valuesOf(const Tree& tree, Order order) {
+        vector<int> result;
+        auto collect = [&](uint32_t node) { result.push_back(tree.value(node)); };
+        switch (order) {
+        case Order::Pre:
+            tree.preorder(collect);
+            break;
+        case Order::In:
+            tree.inorder(collect);
+            break;
+        case Order::Level:
+            tree.levelOrder(collect);
+            break;
+        }
+        return result;
+    }
+
+    static void recursivePreorder(const PointerNode* node, vector<int>& out) {
+        if (node == nullptr) return;
+        out.push_back(node->value);
+        recursivePreorder(node->left, out);
+        recursivePreorder(node->right, out);
+    }
+
+    static void recursiveSum(const PointerNode* node, long long& sum) {
+        if (node == nullptr) return;
+        sum += node->value;
+        recursiveSum(node->left, sum);
+        recursiveSum(node->right, sum);
+    }
+
+    //   ,   fromSorted,    slots   
+    static PointerNode* buildPointerTree(const vector<int>& sorted, const vector<PointerNode*>& slots) {
+        struct Range {
+            int lo, hi;
+            PointerNode** slot;
+        };
+        PointerNode* pointerRoot = nullptr;
+        vector<Range> ranges = { { 0, (int)sorted.size(), &pointerRoot } };
+        while (!ranges.empty()) {
+            Range range = ranges.back();
+            ranges.pop_back();
+            if (range.lo >= range.hi) continue;
+            int mid = range.lo + (range.hi - range.lo) / 2;
+            PointerNode* node = slots[mid];
+            node->value = sorted[mid];
+            *range.slot = node;
+            ranges.push_back({ range.lo, mid, &node->left });
+            ranges.push_back({ mid + 1, range.hi, &node->right });
+        }
+        return pointerRoot;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,792 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <exception>
+#include <cstdint>
+#include <stdexcept>
+
+using namespace std;
+using namespace chrono;
+
+// ====================  - ====================
+
+//  fork-join:     ,   , 
+//    . done  
+struct ForkJoinTask {
+    void (*execute)(ForkJoinTask*) = nullptr;
+    atomic<bool> done{ false };
+    bool root = false;          //     run
+    exception_ptr error;
+};
+
+//   (Chase, Lev 2005;    Le, Pop, Cohen, Nardelli 2013):
+//         ,  
+//    CAS.    ;   
+//   ,         
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(int64_t capacity = 256) {
+        retired.push_back(make_unique<Buffer>(capacity));
+        buffer.store(retired.back().get(), memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    //  
+    void push(ForkJoinTask* task) {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_acquire);
+        Buffer* a = buffer.load(memory_order_relaxed);
+        if (b - t > a->capacity - 1) a = grow(a, t, b);
+        a->put(b, task);
+        bottom.store(b + 1, memory_order_release);
+    }
+
+    //  :     nullptr
+    ForkJoinTask* pop() {
+        int64_t b = bottom.load(memory_order_relaxed) - 1;
+        Buffer* a = buffer.load(memory_order_relaxed);
+        bottom.store(b, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t t = top.load(memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, memory_order_relaxed);
+            return nullptr;
+        }
+        ForkJoinTask* task = a->get(b);
+        if (t == b) {
+            //  :       CAS  top
+            if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) task = nullptr;
+            bottom.store(b + 1, memory_order_relaxed);
+        }
+        return task;
+    }
+
+    //  :     nullptr (   )
+    ForkJoinTask* steal() {
+        int64_t t = top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        int64_t b = bottom.load(memory_order_acquire);
+        if (t >= b) return nullptr;
+        Buffer* a = buffer.load(memory_order_acquire);
+        ForkJoinTask* task = a->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) return nullptr;
+        return task;
+    }
+
+    bool empty() const {
+        return top.load(memory_order_seq_cst) >= bottom.load(memory_order_seq_cst);
+    }
+
+private:
+    struct Buffer {
+        int64_t capacity;
+        unique_ptr<atomic<ForkJoinTask*>[]> slots;
+
+        explicit Buffer(int64_t capacity) : capacity(capacity), slots(new atomic<ForkJoinTask*>[capacity]) {}
+
+        ForkJoinTask* get(int64_t i) const { return slots[i & (capacity - 1)].load(memory_order_relaxed); }
+        void put(int64_t i, ForkJoinTask* task) { slots[i & (capacity - 1)].store(task, memory_order_relaxed); }
+    };
+
+    Buffer* grow(Buffer* old, int64_t t, int64_t b) {
+        retired.push_back(make_unique<Buffer>(old->capacity * 2));
+        Buffer* bigger = retired.back().get();
+        for (int64_t i = t; i < b; i++) bigger->put(i, old->get(i));
+        buffer.store(bigger, memory_order_release);
+        return bigger;
+    }
+
+    alignas(64) atomic<int64_t> top{ 0 };
+    alignas(64) atomic<int64_t> bottom{ 0 };
+    atomic<Buffer*> buffer;
+    vector<unique_ptr<Buffer>> retired;     //   - 
+};
+
+// ====================  FORK-JOIN ====================
+
+//     .    invoke(left, right)
+//  right   ,  left     right 
+// (    -   ), ,    ,
+//    .  -       
+//   :   ,    .
+//  invoke       run   .
+//       join ( left -  )
+class ForkJoinPool {
+    template<typename Func>
+    struct FunctionTask;
+    struct Worker;
+
+public:
+    explicit ForkJoinPool(unsigned threads = 0) {
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        for (unsigned i = 0; i < threads; i++) {
+            workers.push_back(make_unique<Worker>());
+            workers.back()->pool = this;
+            workers.back()->random = 0x9E3779B97F4A7C15ULL * (i + 1);
+        }
+        for (unsigned i = 0; i < threads; i++) {
+            threadsList.emplace_back([this, i]() { workerLoop(*workers[i]); });
+        }
+    }
+
+    ~ForkJoinPool() {
+        stopping.store(true, memory_order_seq_cst);
+        wake(true);
+        for (thread& th : threadsList) th.join();
+    }
+
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    //      ,    
+    static ForkJoinPool& shared() {
+        static ForkJoinPool pool;
+        return pool;
+    }
+
+    unsigned getThreads() const { return (unsigned)workers.size(); }
+
+    //  func      .    
+    //  -  
+    template<typename Func>
+    void run(Func&& func) {
+        if (current != nullptr && current->pool == this) {
+            func();
+            return;
+        }
+        FunctionTask<Func> task(func);
+        task.root = true;
+        {
+            lock_guard<mutex> lock(injectedMutex);
+            injected.push_back(&task);
+            injectedCount.fetch_add(1, memory_order_seq_cst);
+        }
+        wake(false);
+        for (;;) {
+            uint64_t seen = rootsDone.load(memory_order_acquire);
+            if (task.done.load(memory_order_acquire)) break;
+            rootsDone.wait(seen, memory_order_acquire);
+        }
+        if (task.error) rethrow_exception(task.error);
+    }
+
+    //  :   func    ,
+    // join   (  ,    ).  
+    // func  .   join   
+    template<typename Func>
+    class Spawned {
+    public:
+        Spawned(ForkJoinPool& pool, Func& func) : task(func) {
+            if (current != nullptr && current->pool == &pool) {
+                worker = current;
+                worker->deque.push(&task);
+                pool.notifySleepers();
+            }
+            else {
+                task.execute(&task);
+            }
+        }
+
+        Spawned(const Spawned&) = delete;
+        Spawned& operator=(const Spawned&) = delete;
+
+        ~Spawned() {
+            if (!joined) wait();
+        }
+
+        void join() {
+            joined = true;
+            wait();
+            if (task.error) rethrow_exception(task.error);
+        }
+
+    private:
+        void wait() {
+            if (task.done.load(memory_order_acquire)) return;
+            // ,    task,    join:
+            //     task,   ( )
+            if (worker->deque.pop() == &task) {
+                task.execute(&task);
+                return;
+            }
+            worker->pool->helpUntil(*worker, task.done);
+        }
+
+        FunctionTask<Func> task;
+        Worker* worker = nullptr;
+        bool joined = false;
+    };
+
+    template<typename Func>
+    Spawned<Func> spawn(Func& func) {
+        return Spawned<Func>(*this, func);
+    }
+
+    // parallel_invoke:   ,  -  
+    template<typename Left, typename Right>
+    void invoke(Left&& left, Right&& right) {
+        if (current == nullptr || current->pool != this) {
+            run([&]() { invoke(left, right); });
+            return;
+        }
+        Spawned<Right> forked(*this, right);
+        exception_ptr leftError;
+        try {
+            left();
+        }
+        catch (...) {
+            leftError = current_exception();
+        }
+        if (leftError) {
+            //  right      ,   
+            try {
+                forked.join();
+            }
+            catch (...) {
+            }
+            rethrow_exception(leftError);
+        }
+        forked.join();
+    }
+
+    template<typename First, typename Second, typename Third, typename... Rest>
+    void invoke(First&& first, Second&& second, Third&& third, Rest&&... rest) {
+        auto tail = [&]() { invoke(second, third, rest...); };
+        invoke(first, tail);
+    }
+
+    //    :  parallel == false      
+    //  -       
+    template<typename Left, typename Right>
+    void invokeIf(bool parallel, Left&& left, Right&& right) {
+        if (parallel) {
+            invoke(left, right);
+        }
+        else {
+            left();
+            right();
+        }
+    }
+
+private:
+    template<typename Func>
+    struct FunctionTask : ForkJoinTask {
+        Func& func;
+
+        explicit FunctionTask(Func& func) : func(func) {
+            execute = &call;
+        }
+
+        static void call(ForkJoinTask* base) {
+            FunctionTask* self = static_cast<FunctionTask*>(base);
+            try {
+                self->func();
+            }
+            catch (...) {
+                self->error = current_exception();
+            }
+            self->done.store(true, memory_order_release);
+        }
+    };
+
+    struct alignas(64) Worker {
+        WorkStealingDeque deque;
+        ForkJoinPool* pool = nullptr;
+        uint64_t random = 0;
+    };
+
+    static constexpr int SPIN_ROUNDS = 64;
+
+    static inline thread_local Worker* current = nullptr;
+
+    void workerLoop(Worker& self) {
+        current = &self;
+        int idle = 0;
+        while (!stopping.load(memory_order_acquire)) {
+            if (ForkJoinTask* task = findTask(self)) {
+                execute(task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < SPIN_ROUNDS) {
+                this_thread::yield();
+                continue;
+            }
+            // :    ,  
+            //  -        
+            sleeping.fetch_add(1, memory_order_seq_cst);
+            uint64_t seen = epoch.load(memory_order_seq_cst);
+            if (!hasWork() && !stopping.load(memory_order_seq_cst)) epoch.wait(seen, memory_order_seq_cst);
+            sleeping.fetch_sub(1, memory_order_seq_cst);
+            idle = 0;
+        }
+        current = nullptr;
+    }
+
+    void execute(ForkJoinTask* task) {
+        bool root = task->root;
+        task->execute(task);
+        if (root) {
+            rootsDone.fetch_add(1, memory_order_release);
+            rootsDone.notify_all();
+        }
+    }
+
+    ForkJoinTask* findTask(Worker& self) {
+        if (ForkJoinTask* task = self.deque.pop()) return task;
+        if (injectedCount.load(memory_order_acquire) > 0) {
+            lock_guard<mutex> lock(injectedMutex);
+            if (!injected.empty()) {
+                ForkJoinTask* task = injected.back();
+                injected.pop_back();
+                injectedCount.fetch_sub(1, memory_order_relaxed);
+                return task;
+            }
+        }
+        return stealFromOthers(self);
+    }
+
+    ForkJoinTask* stealFromOthers(Worker& self) {
+        const size_t count = workers.size();
+        if (count == 1) return nullptr;
+        // xorshift:    ,     
+        self.random ^= self.random << 13;
+        self.random ^= self.random >> 7;
+        self.random ^= self.random << 17;
+        size_t start = (size_t)(self.random % count);
+        for (size_t k = 0; k < count; k++) {
+            Worker& victim = *workers[(start + k) % count];
+            if (&victim == &self) continue;
+            if (ForkJoinTask* task = victim.deque.steal()) return task;
+        }
+        return nullptr;
+    }
+
+    //   :   ,   .
+    //    ,  root-  ,    
+    void helpUntil(Worker& self, const atomic<bool>& done) {
+        while (!done.load(memory_order_acquire)) {
+            if (ForkJoinTask* task = stealFromOthers(self)) execute(task);
+            else this_thread::yield();
+        }
+    }
+
+    bool hasWork() const {
+        if (injectedCount.load(memory_order_seq_cst) > 0) return true;
+        for (const unique_ptr<Worker>& worker : workers) {
+            if (!worker->deque.empty()) return true;
+        }
+        return false;
+    }
+
+    //  :      - ,
+    //    , join  .  
+    // (run, )   wake
+    void notifySleepers() {
+        if (sleeping.load(memory_order_relaxed) > 0) wake(false);
+    }
+
+    void wake(bool all) {
+        epoch.fetch_add(1, memory_order_seq_cst);
+        if (all) epoch.notify_all();
+        else epoch.notify_one();
+    }
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threadsList;
+    mutex injectedMutex;
+    vector<ForkJoinTask*> injected;
+    atomic<size_t> injectedCount{ 0 };
+    atomic<bool> stopping{ false };
+    atomic<int> sleeping{ 0 };
+    atomic<uint64_t> epoch{ 0 };
+    atomic<uint64_t> rootsDone{ 0 };
+};
+
+// ====================  "  " ====================
+
+//   Source11.cpp  :   - invoke,   grain
+// -   .     
+// n / grain,         
+class ParallelDivideAndConquer {
+public:
+    static constexpr size_t SORT_GRAIN = 1 << 13;
+    static constexpr int FIBONACCI_CUTOFF = 25;
+
+    //  :  ,   
+    //          
+    static void mergeSort(vector<int>& arr, ForkJoinPool& pool, size_t grain = SORT_GRAIN) {
+        if (arr.size() < 2) return;
+        grain = max<size_t>(grain, 2);
+        vector<int> buffer(arr.size());
+        pool.run([&]() { mergeSortRange(pool, arr.data(), buffer.data(), arr.size(), grain); });
+    }
+
+    //    ComplexityClasses::quickSort,   
+    //     :     
+    static void quickSort(vector<int>& arr, ForkJoinPool& pool, size_t grain = SORT_GRAIN) {
+        if (arr.size() < 2) return;
+        grain = max<size_t>(grain, 2);
+        pool.run([&]() { quickSortRange(pool, arr.data(), 0, (int)arr.size() - 1, grain); });
+    }
+
+    //   ,  n - 1  n - 2 
+    static long long fibonacci(int n, ForkJoinPool& pool, int cutoff = FIBONACCI_CUTOFF) {
+        if (n < 0) throw invalid_argument("n   ");
+        long long result = 0;
+        pool.run([&]() { result = fibonacciTask(pool, n, cutoff); });
+        return result;
+    }
+
+    static long long fibonacciSerial(int n) {
+        if (n <= 1) return n;
+        return fibonacciSerial(n - 1) + fibonacciSerial(n - 2);
+    }
+
+private:
+    static long long fibonacciTask(ForkJoinPool& pool, int n, int cutoff) {
+        if (n <= 1 || n <= cutoff) return fibonacciSerial(n);
+        long long a = 0, b = 0;
+        pool.invoke([&]() { a = fibonacciTask(pool, n - 1, cutoff); },
+            [&]() { b = fibonacciTask(pool, n - 2, cutoff); });
+        return a + b;
+    }
+
+    static void mergeSortRange(ForkJoinPool& pool, int* data, int* buffer, size_t n, size_t grain) {
+        if (n <= grain) {
+            serialMergeSort(data, buffer, n);
+            return;
+        }
+        const size_t half = n / 2;
+        pool.invoke([&]() { mergeSortRange(pool, data, buffer, half, grain); },
+            [&]() { mergeSortRange(pool, data + half, buffer + half, n - half, grain); });
+        parallelMerge(pool, data, half, data + half, n - half, buffer, grain);
+        parallelCopy(pool, buffer, n, data, grain);
+    }
+
+    static void serialMergeSort(int* data, int* buffer, size_t n) {
+        if (n < 2) return;
+        const size_t half = n / 2;
+        serialMergeSort(data, buffer, half);
+        serialMergeSort(data + half, buffer + half, n - half);
+        merge(data, data + half, data + half, data + n, buffer);
+        copy(buffer, buffer + n, data);
+    }
+
+    //     :  a    
+    static void parallelMerge(ForkJoinPool& pool, const int* a, size_t na, const int* b, size_t nb, int* out,
+        size_t grain) {
+        if (na + nb <= grain) {
+            merge(a, a + na, b, b + nb, out);
+            return;
+        }
+        size_t i, j;
+        if (na >= nb) {
+            i = na / 2;
+            j = (size_t)(lower_bound(b, b + nb, a[i]) - b);
+        }
+        else {
+            j = nb / 2;
+            i = (size_t)(upper_bound(a, a + na, b[j]) - a);
+        }
+        pool.invoke([&]() { parallelMerge(pool, a, i, b, j, out, grain); },
+            [&]() { parallelMerge(pool, a + i, na - i, b + j, nb - j, out + i + j, grain); });
+    }
+
+    static void parallelCopy(ForkJoinPool& pool, const int* from, size_t n, int* to, size_t grain) {
+        if (n <= grain) {
+            copy(from, from + n, to);
+            return;
+        }
+        const size_t half = n / 2;
+        pool.invoke([&]() { parallelCopy(pool, from, half, to, grain); },
+            [&]() { parallelCopy(pool, from + half, n - half, to + half, grain); });
+    }
+
+    //    :   ,      
+    struct QuickSortPart {
+        ForkJoinPool* pool;
+        int* data;
+        int low, high;
+        size_t grain;
+
+        void operator()() const { quickSortRange(*pool, data, low, high, grain); }
+    };
+
+    static constexpr int MAX_QUICK_FORKS = 32;
+    static constexpr int INSERTION_SORT_LIMIT = 16;
+
+    static void quickSortRange(ForkJoinPool& pool, int* data, int low, int high, size_t grain) {
+        if ((size_t)(high - low + 1) <= grain) {
+            quickSortSerial(data, low, high);
+            return;
+        }
+        //   -  ,  -     .
+        //      ;   ,  
+        // (  )  :  O(log n)
+        QuickSortPart parts[MAX_QUICK_FORKS];
+        optional<ForkJoinPool::Spawned<QuickSortPart>> forks[MAX_QUICK_FORKS];
+        int forked = 0;
+        while ((size_t)(high - low + 1) > grain) {
+            const int split = partition(data, low, high);
+            int smallLow = low, smallHigh = split;
+            if (split - low >= high - split) {
+                smallLow = split + 1;
+                smallHigh = high;
+                high = split;
+            }
+            else {
+                low = split + 1;
+            }
+            if (smallLow >= smallHigh) continue;
+            if (forked < MAX_QUICK_FORKS) {
+                parts[forked] = { &pool, data, smallLow, smallHigh, grain };
+                forks[forked].emplace(pool, parts[forked]);
+                forked++;
+            }
+            else {
+                quickSortRange(pool, data, smallLow, smallHigh, grain);
+            }
+        }
+        quickSortSerial(data, low, high);
+        //     :    -  
+        exception_ptr error;
+        for (int i = forked - 1; i >= 0; i--) {
+            try {
+                forks[i]->join();
+            }
+            catch (...) {
+                if (!error) error = current_exception();
+            }
+        }
+        if (error) rethrow_exception(error);
+    }
+
+    //  :    ,   ,
+    //  - 
+    static void quickSortSerial(int* data, int low, int high) {
+        while (high - low >= INSERTION_SORT_LIMIT) {
+            const int split = partition(data, low, high);
+            if (split - low < high - split) {
+                quickSortSerial(data, low, split);
+                low = split + 1;
+            }
+            else {
+                quickSortSerial(data, split + 1, high);
+                high = split;
+            }
+        }
+        insertionSort(data, low, high);
+    }
+
+    //      :     
+    // ,        . 
+    // j: [low, j] <=  <= [j + 1, high], low <= j < high
+    static int partition(int* data, int low, int high) {
+        const int middle = low + (high - low) / 2;
+        if (data[middle] < data[low]) swap(data[middle], data[low]);
+        if (data[high] < data[low]) swap(data[high], data[low]);
+        if (data[high] < data[middle]) swap(data[high], data[middle]);
+        swap(data[low], data[middle]);
+        const int pivot = data[low];
+        int i = low - 1, j = high + 1;
+        for (;;) {
+            do i++; while (data[i] < pivot);
+            do j--; while (pivot < data[j]);
+            if (i >= j) return j;
+            swap(data[i], data[j]);
+        }
+    }
+
+    //  -     INSERTION_SORT_LIMIT
+    static void insertionSort(int* data, int low, int high) {
+        for (int i = low + 1; i <= high; i++) {
+            int value = data[i];
+            int j = i - 1;
+            for (; j >= low && value < data[j]; j--) data[j + 1] = data[j];
+            data[j + 1] = value;
+        }
+    }
+};
+
+// ====================  FORK-JOIN ====================
+
+class ForkJoinBenchmark {
+public:
+    static bool verify() {
+        cout << "===  FORK-JOIN ===" << endl;
+        bool ok = true;
+        mt19937 gen(37);
+
+        // :          
+        {
+            const int count = 200000;
+            vector<ForkJoinTask> tasks(count);
+            vector<atomic<int>> taken(count);
+            WorkStealingDeque deque(4);
+            atomic<bool> finished{ false };
+            auto thief = [&]() {
+                while (!finished.load(memory_order_acquire) || !deque.empty()) {
+                    if (ForkJoinTask* task = deque.steal()) taken[task - tasks.data()]++;
+                }
+            };
+            vector<thread> thieves;
+            for (int t = 0; t < 3; t++) thieves.emplace_back(thief);
+            for (int i = 0; i < count; i++) {
+                deque.push(&tasks[i]);
+                if (i % 3 == 0) {
+                    if (ForkJoinTask* task = deque.pop()) taken[task - tasks.data()]++;
+                }
+            }
+            while (ForkJoinTask* task = deque.pop()) taken[task - tasks.data()]++;
+            finished.store(true, memory_order_release);
+            for (thread& th : thieves) th.join();
+            for (int i = 0; i < count; i++) ok = ok && taken[i] == 1;
+        }
+
+        for (unsigned threads : { 1u, 2u, 4u }) {
+            ForkJoinPool pool(threads);
+            for (int trial = 0; trial < 20 && ok; trial++) {
+                size_t n = gen() % 100000;
+                vector<int> data(n);
+                for (int& x : data) x = (int)(gen() % 1000);
+                vector<int> expected = data;
+                sort(expected.begin(), expected.end());
+                vector<int> merged = data, quick = data;
+                size_t grain = 2 + gen() % 64;
+                ParallelDivideAndConquer::mergeSort(merged, pool, grain);
+                ParallelDivideAndConquer::quickSort(quick, pool, grain);
+                ok = merged == expected && quick == expected;
+            }
+            for (int n = 0; n <= 25 && ok; n++) {
+                ok = ParallelDivideAndConquer::fibonacci(n, pool, 2) == ParallelDivideAndConquer::fibonacciSerial(n);
+            }
+
+            //  ,       : 
+            //  O(log n),   O(n)
+            vector<int> sorted(1 << 20);
+            for (int i = 0; i < (int)sorted.size(); i++) sorted[i] = i;
+            vector<int> quick = sorted;
+            ParallelDivideAndConquer::quickSort(quick, pool);
+            ok = ok && quick == sorted;
+            vector<int> equal(1 << 20, 7);
+            ParallelDivideAndConquer::quickSort(equal, pool);
+            ok = ok && equal == vector<int>(1 << 20, 7);
+            for (int distinct : { 2, 1000 }) {
+                vector<int> few(1 << 20);
+                for (int& x : few) x = (int)(gen() % distinct);
+                vector<int> expected = few;
+                sort(expected.begin(), expected.end());
+                ParallelDivideAndConquer::quickSort(few, pool, 2 + gen() % 64);
+                ok = ok && few == expected;
+            }
+
+            //      ,   
+            bool threw = false;
+            try {
+                pool.invoke([]() {}, []() { throw runtime_error(""); });
+            }
+            catch (const runtime_error&) {
+                threw = true;
+            }
+            ok = ok && threw;
+
+            //       
+            vector<long long> results(3, 0);
+            vector<thread> clients;
+            for (int c = 0; c < 3; c++) {
+                clients.emplace_back([&, c]() { results[c] = ParallelDivideAndConquer::fibonacci(20 + c, pool, 10); });
+            }
+            for (thread& th : clients) th.join();
+            ok = ok && results[0] == 6765 && results[1] == 10946 && results[2] == 17711;
+
+            long long a = 0, b = 0, c = 0;
+            pool.invoke([&]() { a = 1; }, [&]() { b = 2; }, [&]() { c = 3; });
+            ok = ok && a + b + c == 6;
+
+            // spawn / join :  0..999  10  
+            long long total = 0;
+            pool.run([&]() {
+                vector<long long> parts(10, 0);
+                auto part = [&](int k) {
+                    for (int i = 100 * k; i < 100 * (k + 1); i++) parts[k] += i;
+                };
+                auto first = [&]() { part(0); };
+                auto rest = [&]() {
+                    for (int k = 1; k < 10; k++) part(k);
+                };
+                auto spawned = pool.spawn(rest);
+                first();
+                spawned.join();
+                for (long long value : parts) total += value;
+            });
+            ok = ok && total == 999 * 1000 / 2;
+        }
+
+        cout << (ok ? "OK" : "") << endl;
+        return ok;
+    }
+
+    //   Source11.cpp     
+    static void compareSpeedup(int n = 10000000, int fibN = 38) {
+        unsigned threads = max(1u, thread::hardware_concurrency());
+        cout << "\n=== FORK-JOIN: " << threads << "  ===" << endl;
+        ForkJoinPool single(1), pool(threads);
+
+        //  : fib(30)       
+        const int overheadN = 30;
+        auto start = high_resolution_clock::now();
+        long long serial = ParallelDivideAndConquer::fibonacciSerial(overheadN);
+        auto middle = high_resolution_clock::now();
+        long long forked = ParallelDivideAndConquer::fibonacci(overheadN, single, 1);
+        auto end = high_resolution_clock::now();
+        //   n >= 2    fib(n) - fib(n + 1) - 1,   
+        double tasks = (double)(ParallelDivideAndConquer::fibonacciSerial(overheadN + 1) - 1);
+        double perTask = (duration_cast<nanoseconds>(end - middle).count() -
+            duration_cast<nanoseconds>(middle - start).count()) / tasks;
+        cout << " : ~" << (int)max(0.0, perTask) << " " << (serial == forked ? "" : " ")
+            << endl;
+
+        mt19937 gen(41);
+        vector<int> data(n);
+        for (int& x : data) x = (int)gen();
+        vector<int> expected = data;
+        sort(expected.begin(), expected.end());
+
+        auto timeSort = [&](auto sortFunc) {
+            vector<int> copyOfData = data;
+            auto begin = high_resolution_clock::now();
+            sortFunc(copyOfData);
+            auto finish = high_resolution_clock::now();
+            return make_pair(duration_cast<milliseconds>(finish - begin).count(), copyOfData == expected);
+        };
+        auto mergeSerial = timeSort([&](vector<int>& v) { ParallelDivideAndConquer::mergeSort(v, single, v.size()); });
+        auto mergeParallel = timeSort([&](vector<int>& v) { ParallelDivideAndConquer::mergeSort(v, pool); });
+        cout << ", " << n << " : 1  " << mergeSerial.first << " , " << threads << " - "
+            << mergeParallel.first << " " << (mergeSerial.second && mergeParallel.second ? "" : " ") << endl;
+        auto quickSerial = timeSort([&](vector<int>& v) { ParallelDivideAndConquer::quickSort(v, single, v.size()); });
+        auto quickParallel = timeSort([&](vector<int>& v) { ParallelDivideAndConquer::quickSort(v, pool); });
+        cout << ", " << n << " : 1  " << quickSerial.first << " , " << threads << " - "
+            << quickParallel.first << " " << (quickSerial.second && quickParallel.second ? "" : " ") << endl;
+
+        start = high_resolution_clock::now();
+        serial = ParallelDivideAndConquer::fibonacciSerial(fibN);
+        middle = high_resolution_clock::now();
+        long long parallel = ParallelDivideAndConquer::fibonacci(fibN, pool);
+        end = high_resolution_clock::now();
+        cout << "fib(" << fibN << "): 1  " << duration_cast<milliseconds>(middle - start).count() << " , "
+            << threads << " - " << duration_cast<milliseconds>(end - middle).count() << " "
+            << (serial == parallel ? "" : " ") << endl;
+    }
+};
\ No newline at end of file